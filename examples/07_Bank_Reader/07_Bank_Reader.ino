@@ -0,0 +1,107 @@
+/**
+ * @file 07_Bank_Reader.ino
+ *
+ * @brief MCP23017 bank reader: one GPIOAB transaction per update() fills the
+ *        packed raw-state bitmap for every button (no per-button callbacks).
+ */
+
+// Explicit button mapping (compile-time). MUST be BEFORE <Universal_Button> header include.
+// When using a port expander, ButtonTest numbers are irrelevant e.g. 60, 61, 62... as long as they're different.
+#define BUTTON_LIST(X) \
+    X(TestButton1, 6)  \
+    X(TestButton2, 7)  \
+    X(TestButton3, 8)
+
+#include <Arduino.h>
+#include <Universal_Button.h>
+#include <Universal_Button_Utils.h>
+#include <Wire.h>
+#include <Adafruit_MCP23X17.h>
+
+// MCP23017 wiring/config.
+constexpr uint8_t MCP_ADDR = 0x20;
+
+// Map each logical button (by enum order) to MCP pin 0..15 (0..7=A, 8..15=B).
+constexpr uint8_t MCP_PINS[NUM_BUTTONS] = {
+    0, ///< TestButton1 -> GPA0.
+    1, ///< TestButton2 -> GPA1.
+    8  ///< TestButton3 -> GPB0.
+};
+static_assert(NUM_BUTTONS == (sizeof(MCP_PINS) / sizeof(MCP_PINS[0])),
+              "MCP_PINS size must match NUM_BUTTONS");
+
+// Custom timings (debounce, short, long) in milliseconds.
+constexpr ButtonTimingConfig kTiming{50, 300, 1500};
+
+static Adafruit_MCP23X17 mcp;
+
+/**
+ * Bank reader: a single 16-bit read covers every button on the expander.
+ * gatherPortBits() sets bit i for each logical button whose MCP pin reads LOW.
+ */
+static void readBank(void *ctx, uint32_t *words, size_t /*nwords*/)
+{
+    Adafruit_MCP23X17 *dev = static_cast<Adafruit_MCP23X17 *>(ctx);
+    const uint16_t ab = dev->readGPIOAB(); ///< [low byte]=A, [high byte]=B.
+    UB::util::gatherPortBits(ab, MCP_PINS, words);
+}
+
+// Build handler with the bank reader; skip MCU pin init.
+static Button btns = makeButtonsWithBankReader(readBank, &mcp, kTiming, /*skipPinInit=*/true);
+
+// Configure MCP button pins once.
+static void configureMcpPins()
+{
+    for (uint8_t i = 0; i < NUM_BUTTONS; ++i)
+    {
+        const uint8_t p = MCP_PINS[i];
+        mcp.pinMode(p, INPUT_PULLUP);
+    }
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(50);
+
+    // Initialize I2C.
+    Wire.begin();
+
+    // Initialize the MCP23017.
+    if (!mcp.begin_I2C(MCP_ADDR))
+    {
+        Serial.println("MCP23017 not found!");
+        while (true)
+        {
+            delay(1000);
+        }
+    }
+
+    configureMcpPins();
+}
+
+void loop()
+{
+    btns.update(); ///< Calls readBank() exactly once.
+
+    const ButtonPressType btn1 = btns.getPressType(ButtonIndex::TestButton1);
+    const ButtonPressType btn2 = btns.getPressType(ButtonIndex::TestButton2);
+    const ButtonPressType btn3 = btns.getPressType(ButtonIndex::TestButton3);
+
+    if (btn1 == ButtonPressType::Short)
+        Serial.println("TestButton1: Short press...");
+    else if (btn1 == ButtonPressType::Long)
+        Serial.println("TestButton1: Long press...");
+
+    if (btn2 == ButtonPressType::Short)
+        Serial.println("TestButton2: Short press...");
+    else if (btn2 == ButtonPressType::Long)
+        Serial.println("TestButton2: Long press...");
+
+    if (btn3 == ButtonPressType::Short)
+        Serial.println("TestButton3: Short press...");
+    else if (btn3 == ButtonPressType::Long)
+        Serial.println("TestButton3: Long press...");
+
+    delay(10);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file 08_Edge_ISR.ino
+ *
+ * @brief Edge-driven input: a pin-change ISR queues raw edges and update()
+ *        debounces from the queue instead of polling the pin every scan.
+ */
+
+// Enable a 16-entry ISR edge queue. MUST be BEFORE <Universal_Button> header include.
+#define UB_EDGE_QUEUE_SIZE 16
+
+// Explicit button mapping (compile-time). Use an interrupt-capable pin.
+#define BUTTON_LIST(X) \
+    X(TestButton, 2) ///< TestButton == GPIO2. INPUT_PULLUP (pressed == LOW).
+
+#include <Arduino.h>
+#include <Universal_Button.h>
+
+#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_ESP8266)
+#define UB_EXAMPLE_ISR_ATTR IRAM_ATTR
+#else
+#define UB_EXAMPLE_ISR_ATTR
+#endif
+
+// Create handler sized to NUM_BUTTONS; the GPIO reader is kept for re-seeding levels.
+static Button btns = makeButtons();
+
+/**
+ * Pin-change ISR: pass the raw level in reader convention (true = pin reads LOW),
+ * exactly what the default GPIO reader would have returned for this pin.
+ */
+static void UB_EXAMPLE_ISR_ATTR onTestButtonEdge()
+{
+    const uint8_t pin = BUTTON_PINS[static_cast<uint8_t>(ButtonIndex::TestButton)];
+    btns.onEdgeISR(ButtonIndex::TestButton, digitalRead(pin) == LOW, millis());
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(50);
+
+    const uint8_t pin = BUTTON_PINS[static_cast<uint8_t>(ButtonIndex::TestButton)];
+    attachInterrupt(digitalPinToInterrupt(pin), onTestButtonEdge, CHANGE);
+
+    btns.setEdgeMode(true); ///< Next update() seeds the current level, then drains edges only.
+}
+
+void loop()
+{
+    btns.update(); ///< No pin reads while idle; cost scales with queued edges.
+
+    switch (btns.getPressType(ButtonIndex::TestButton))
+    {
+    case ButtonPressType::Short:
+        Serial.println("Short press detected!");
+        break;
+
+    case ButtonPressType::Double:
+        Serial.println("Double-click detected!");
+        break;
+
+    case ButtonPressType::Long:
+        Serial.println("Long press detected!");
+        break;
+
+    default:
+        break;
+    }
+
+    // Overflow is self-healing (levels are re-sampled), but a non-zero count means the
+    // queue is too small for the bounce this switch produces.
+    static uint16_t reportedOverflows = 0;
+    if (btns.edgeOverflowCount() != reportedOverflows)
+    {
+        reportedOverflows = btns.edgeOverflowCount();
+        Serial.print("Edge queue overflows: ");
+        Serial.println(reportedOverflows);
+    }
+
+    delay(10);
+}
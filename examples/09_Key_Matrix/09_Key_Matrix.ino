@@ -0,0 +1,73 @@
+/**
+ * @file 09_Key_Matrix.ino
+ *
+ * @brief 4x4 key matrix scanned through MatrixReader: one bank read per update()
+ *        debounces all 16 keys, with ghost-key blocking enabled.
+ */
+
+// Single placeholder mapping; the matrix handler below does not use BUTTON_LIST.
+#define BUTTON_LIST(X) \
+    X(Unused, 0)
+
+#include <Arduino.h>
+#include <Universal_Button.h>
+
+// Matrix wiring: rows are driven LOW one at a time, columns use INPUT_PULLUP.
+constexpr uint8_t ROW_PINS[4] = {2, 3, 4, 5};
+constexpr uint8_t COL_PINS[4] = {6, 7, 8, 9};
+
+// Key labels in row-major order (key index = row * 4 + col).
+static const char KEY_LABELS[16] = {
+    '1', '2', '3', 'A',
+    '4', '5', '6', 'B',
+    '7', '8', '9', 'C',
+    '*', '0', '#', 'D'};
+
+static MatrixReader<4, 4> matrix(ROW_PINS, COL_PINS, /*settleUs=*/5);
+
+// One logical button per key; scanned via the bank-reader path.
+static auto keys = makeButtonsWithMatrix(matrix, ButtonTimingConfig{20, 50, 800, 0});
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(50);
+
+    matrix.begin();                  ///< Configure row/column pins.
+    matrix.setGhostDetection(true);  ///< Block ambiguous 3-key rectangles (no diodes).
+}
+
+void loop()
+{
+    keys.update(); ///< Scans 4 rows once.
+
+    // Skip the per-key loop entirely when nothing has an event.
+    uint32_t events[decltype(keys)::kWords];
+    keys.eventWords(events, decltype(keys)::kWords);
+
+    if (events[0] != 0U)
+    {
+        for (uint8_t k = 0; k < keys.size(); ++k)
+        {
+            const ButtonPressType evt = keys.getPressType(k);
+            if (evt == ButtonPressType::Short)
+            {
+                Serial.print("Key ");
+                Serial.println(KEY_LABELS[k]);
+            }
+            else if (evt == ButtonPressType::Long)
+            {
+                Serial.print("Key held ");
+                Serial.println(KEY_LABELS[k]);
+            }
+        }
+    }
+
+    // Report ghosting once per occurrence.
+    static bool wasGhosted = false;
+    if (matrix.ghosted() && !wasGhosted)
+        Serial.println("Ghosting detected: add diodes or avoid 3-key rectangles.");
+    wasGhosted = matrix.ghosted();
+
+    delay(5);
+}
@@ -0,0 +1,91 @@
+/**
+ * @file 10_Layout_Benchmark.ino
+ *
+ * @brief Times update() for the SoA and AoS per-button state layouts on the same
+ *        synthetic bank-reader workload and prints microseconds per update().
+ */
+
+// Single placeholder mapping; the benchmark handlers below do not use BUTTON_LIST.
+#define BUTTON_LIST(X) \
+    X(Unused, 0)
+
+#include <Arduino.h>
+#include <Universal_Button.h>
+
+// Buttons per handler. Two handlers are allocated, so keep this small on AVR (e.g. 16).
+#if defined(ARDUINO_ARCH_AVR)
+constexpr size_t kButtons = 16;
+#else
+constexpr size_t kButtons = 192;
+#endif
+
+constexpr uint32_t kScans = 5000; ///< update() calls per measurement.
+
+static const uint8_t keys[kButtons] = {}; ///< IDs are unused by the bank reader.
+static uint32_t rng = 0x12345678UL;
+static uint32_t virtualMs = 0; ///< Shared 1 ms-per-scan clock (keeps moving across runs).
+
+/**
+ * Synthetic bank reader: a slowly moving band of held buttons plus random bounce
+ * on about 1 in 16 buttons per scan, so both the idle and the active paths run.
+ */
+static void readBank(void *ctx, uint32_t *words, size_t nwords)
+{
+    const uint32_t scan = *static_cast<const uint32_t *>(ctx);
+    for (size_t i = 0; i < kButtons && (i >> 5) < nwords; ++i)
+    {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        const bool held = ((i + (scan >> 6)) % 8u) == 0u;
+        const bool bounce = (rng & 15u) == 0u;
+        if (held != bounce)
+            words[i >> 5] |= (static_cast<uint32_t>(1u) << (i & 31u));
+    }
+}
+
+static uint32_t scanNo = 0;
+static ButtonHandler<kButtons, UB::layout::SoA> soa(keys, readBank, &scanNo, ButtonTimingConfig{20, 200, 800, 300});
+static ButtonHandler<kButtons, UB::layout::AoS> aos(keys, readBank, &scanNo, ButtonTimingConfig{20, 200, 800, 300});
+
+/**
+ * Run kScans updates on one handler with a 1 ms virtual clock.
+ * @return Average microseconds per update().
+ */
+template <typename H>
+static float timeUpdates(H &h)
+{
+    rng = 0x12345678UL;
+    const uint32_t t0 = micros();
+    for (scanNo = 0; scanNo < kScans; ++scanNo)
+    {
+        h.update(++virtualMs);
+        for (size_t i = 0; i < kButtons; i += 32)
+            (void)h.getPressType(static_cast<uint8_t>(i)); ///< Consume a few slots so events keep flowing.
+    }
+    const uint32_t dt = micros() - t0;
+    return static_cast<float>(dt) / static_cast<float>(kScans);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(50);
+
+    Serial.print("Buttons: ");
+    Serial.println(static_cast<unsigned>(kButtons));
+    Serial.print("SoA state bytes: ");
+    Serial.println(static_cast<unsigned>(sizeof(soa)));
+    Serial.print("AoS state bytes: ");
+    Serial.println(static_cast<unsigned>(sizeof(aos)));
+}
+
+void loop()
+{
+    Serial.print("SoA us/update: ");
+    Serial.println(timeUpdates(soa), 2);
+    Serial.print("AoS us/update: ");
+    Serial.println(timeUpdates(aos), 2);
+    Serial.println();
+    delay(2000);
+}
@@ -0,0 +1,55 @@
+/**
+ * @file 11_Button_Group.ino
+ *
+ * @brief ButtonGroup: one millis() read per loop drives two handlers, panel keys
+ *        scanned every loop (~1 kHz) and foot pedals at 100 Hz.
+ */
+
+// Panel keys (easy header mapping). MUST be BEFORE <Universal_Button> header include.
+#define BUTTON_LIST(X)  \
+    X(PanelPlay, 4)     \
+    X(PanelStop, 5)     \
+    X(PanelRecord, 6)
+
+#include <Arduino.h>
+#include <Universal_Button.h>
+
+// Foot pedals on their own pins, with a longer debounce for mechanical switches.
+constexpr uint8_t PEDAL_PINS[2] = {10, 11};
+
+static Button panel = makeButtons();
+static auto pedals = makeButtonsWithPins(PEDAL_PINS, ButtonTimingConfig{60, 80, 1200, 0});
+
+static ButtonGroup<2> group;
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(50);
+
+    group.add(panel);                   ///< Every group.update().
+    group.add(pedals, /*periodMs=*/10); ///< 100 Hz.
+}
+
+void loop()
+{
+    group.update(); ///< Reads millis() once; scans whichever members are due.
+
+    if (panel.getPressType(ButtonIndex::PanelPlay) == ButtonPressType::Short)
+        Serial.println("Play");
+    if (panel.getPressType(ButtonIndex::PanelStop) == ButtonPressType::Short)
+        Serial.println("Stop");
+    if (panel.getPressType(ButtonIndex::PanelRecord) == ButtonPressType::Long)
+        Serial.println("Record (held)");
+
+    const ButtonPressType pedal0 = pedals.getPressType(0);
+    if (pedal0 == ButtonPressType::Short)
+        Serial.println("Pedal 1: tap");
+    else if (pedal0 == ButtonPressType::Long)
+        Serial.println("Pedal 1: hold");
+
+    if (pedals.getPressType(1) == ButtonPressType::Short)
+        Serial.println("Pedal 2: tap");
+
+    delay(1);
+}
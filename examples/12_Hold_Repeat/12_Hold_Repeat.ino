@@ -0,0 +1,67 @@
+/**
+ * @file 12_Hold_Repeat.ino
+ *
+ * @brief Menu navigation with hold-repeat: tap Up/Down to step once, hold to scroll
+ *        with an accelerating repeat rate. Select never repeats.
+ */
+
+// Explicit button mapping (compile-time). MUST be BEFORE <Universal_Button> header include.
+#define BUTTON_LIST(X) \
+    X(Up, 4)           \
+    X(Down, 5)         \
+    X(Select, 6)
+
+#include <Arduino.h>
+#include <Universal_Button.h>
+
+static Button btns = makeButtons();
+static int item = 0; ///< Current menu position.
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(50);
+
+    // Global repeat stays off (repeat_delay_ms == 0); Up/Down opt in. Acceleration is
+    // global: each gap 15 ms shorter than the previous one, down to 30 ms.
+    ButtonTimingConfig t{};
+    t.repeat_accel_ms = 15;
+    t.repeat_min_ms = 30;
+    btns.setGlobalTiming(t);
+
+    ButtonPerConfig nav{};
+    nav.repeat_delay_ms = 400;    ///< Hold 400 ms before scrolling starts.
+    nav.repeat_interval_ms = 150; ///< First gap; later gaps accelerate.
+    nav.no_double = true; ///< Taps step on release (no double-click wait).
+    btns.setPerConfig(ButtonIndex::Up, nav);
+    btns.setPerConfig(ButtonIndex::Down, nav);
+}
+
+void loop()
+{
+    btns.update();
+
+    const ButtonPressType up = btns.getPressType(ButtonIndex::Up);
+    if (up == ButtonPressType::Short || up == ButtonPressType::Repeat)
+    {
+        ++item;
+        Serial.print("Item ");
+        Serial.println(item);
+    }
+
+    const ButtonPressType down = btns.getPressType(ButtonIndex::Down);
+    if (down == ButtonPressType::Short || down == ButtonPressType::Repeat)
+    {
+        --item;
+        Serial.print("Item ");
+        Serial.println(item);
+    }
+
+    if (btns.getPressType(ButtonIndex::Select) == ButtonPressType::Short)
+    {
+        Serial.print("Selected ");
+        Serial.println(item);
+    }
+
+    delay(5);
+}
@@ -0,0 +1,285 @@
+/**
+ * @file 13_Update_Benchmark.ino
+ *
+ * @brief Measures update() cost for N = 1, 8, 32, 128, 255 buttons across the reader
+ *        kinds (ReadPinFn, ReadFn, ReadBankFn, native GPIO) and three input traces
+ *        (idle, bouncing, heavy activity). Prints one CSV row per combination:
+ *
+ *            N,reader,trace,ns_per_update,cycles_per_update
+ *
+ * On target the sketch times with micros() and, where available, a cycle counter
+ * (ESP.getCycleCount() on ESP32/ESP8266, DWT->CYCCNT on Cortex-M3/M4/M7). The same
+ * file also builds natively on a desktop, so upgrades can be compared without hardware:
+ *
+ *     g++ -std=c++17 -O2 -x c++ -Isrc examples/13_Update_Benchmark/13_Update_Benchmark.ino -o ub_bench
+ *     ./ub_bench > before.csv
+ *
+ * Save the output of two library versions and diff them. Numbers are the average of
+ * many update() calls, with the cost of generating the trace subtracted.
+ */
+
+// Pin read by the native-GPIO runs (every benchmark key points at it). Leave it floating
+// or tie it high. MUST be BEFORE <Universal_Button> header include.
+#define BUTTON_LIST(X) \
+    X(BenchPin, 4)
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#include <stdio.h>
+#endif
+#include <Universal_Button.h>
+
+// ---- Sizes per platform (the largest handler must fit in RAM) ---- //
+
+#if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_MEGAAVR)
+#define BENCH_SIZES(X) X(1) X(8) X(16)
+#elif defined(ARDUINO_ARCH_STM32) || defined(ARDUINO_ARCH_SAMD)
+#define BENCH_SIZES(X) X(1) X(8) X(32) X(128)
+#else
+#define BENCH_SIZES(X) X(1) X(8) X(32) X(128) X(255)
+#endif
+
+#if defined(ARDUINO)
+constexpr uint32_t kWork = 50000UL; ///< update() calls x buttons per measurement.
+#else
+constexpr uint32_t kWork = 4000000UL;
+#endif
+
+// ---- Clocks ---- //
+
+/**
+ * Elapsed-time source in nanoseconds.
+ */
+static uint32_t nowNs()
+{
+#if defined(ARDUINO)
+    return static_cast<uint32_t>(micros()) * 1000UL;
+#else
+    using namespace std::chrono;
+    return static_cast<uint32_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_ESP8266)
+#define BENCH_HAS_CYCLES 1
+static void cyclesInit() {}
+static uint32_t cycles() { return ESP.getCycleCount(); }
+#elif defined(ARDUINO) && (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__))
+#define BENCH_HAS_CYCLES 1
+static inline volatile uint32_t &reg(uintptr_t addr) { return *reinterpret_cast<volatile uint32_t *>(addr); }
+static void cyclesInit()
+{
+    reg(0xE000EDFCUL) |= (1UL << 24); ///< DEMCR.TRCENA: enable the DWT block.
+    reg(0xE0001004UL) = 0;            ///< DWT_CYCCNT.
+    reg(0xE0001000UL) |= 1UL;         ///< DWT_CTRL.CYCCNTENA.
+}
+static uint32_t cycles() { return reg(0xE0001004UL); }
+#elif !defined(ARDUINO) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define BENCH_HAS_CYCLES 1
+static void cyclesInit() {}
+static uint32_t cycles() { return static_cast<uint32_t>(__rdtsc()); }
+#else
+#define BENCH_HAS_CYCLES 0
+static void cyclesInit() {}
+static uint32_t cycles() { return 0; }
+#endif
+
+// ---- Output ---- //
+
+#if defined(ARDUINO)
+static void out(const char *s) { Serial.print(s); }
+static void out(uint32_t v) { Serial.print(v); }
+static void out(float v) { Serial.print(v, 1); }
+static void outln() { Serial.println(); }
+#else
+static void out(const char *s) { printf("%s", s); }
+static void out(uint32_t v) { printf("%lu", static_cast<unsigned long>(v)); }
+static void out(float v) { printf("%.1f", static_cast<double>(v)); }
+static void outln() { printf("\n"); }
+#endif
+
+// ---- Input traces ---- //
+
+enum class Trace : uint8_t
+{
+    Idle,   ///< Everything released: the idle fast path.
+    Bounce, ///< About 1 in 8 buttons reads pressed for single scans: debounce windows never settle.
+    Heavy   ///< A quarter of the buttons held, the set moving every 64 scans: presses, releases, events.
+};
+
+static const char *const kTraceNames[] = {"idle", "bounce", "heavy"};
+
+static uint32_t levels[8]; ///< Raw pressed bits for the current scan (up to 256 buttons).
+static uint8_t cursor = 0; ///< Next button a per-button reader returns.
+static uint32_t rng = 0x12345678UL;
+
+static inline uint32_t xorshift()
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+/**
+ * Build the raw levels for one scan.
+ */
+static inline void fillLevels(Trace t, uint32_t scan, size_t nwords)
+{
+    for (size_t w = 0; w < nwords; ++w)
+    {
+        if (t == Trace::Idle)
+            levels[w] = 0U;
+        else if (t == Trace::Bounce)
+            levels[w] = xorshift() & xorshift() & xorshift();
+        else
+            levels[w] = 0x11111111UL << ((scan >> 6) & 3u);
+    }
+    cursor = 0;
+}
+
+// Every benchmark key is the native pin, so per-button readers walk a cursor instead of
+// decoding the key; update() reads enabled buttons in index order, once per scan.
+static bool readPin(uint8_t)
+{
+    const uint8_t i = cursor++;
+    return (levels[i >> 5] >> (i & 31u)) & 1u;
+}
+
+static bool readCtx(void *ctx, uint8_t)
+{
+    const uint32_t *lv = static_cast<const uint32_t *>(ctx);
+    const uint8_t i = cursor++;
+    return (lv[i >> 5] >> (i & 31u)) & 1u;
+}
+
+static void readBank(void *ctx, uint32_t *words, size_t nwords)
+{
+    const uint32_t *lv = static_cast<const uint32_t *>(ctx);
+    for (size_t w = 0; w < nwords; ++w)
+        words[w] = lv[w];
+}
+
+// ---- Benchmark ---- //
+
+enum class Reader : uint8_t
+{
+    Pin,
+    Ctx,
+    Bank,
+    Native
+};
+
+static const char *const kReaderNames[] = {"ReadPinFn", "ReadFn", "ReadBankFn", "native"};
+
+static uint32_t virtualMs = 0; ///< 1 ms per scan, shared so handlers never see time go back.
+
+/**
+ * Time one reader/trace combination on a handler.
+ */
+template <size_t N>
+static void measure(ButtonHandler<N> &h, Reader r, Trace t)
+{
+    h.setReadBankFn(nullptr, nullptr);
+    h.setReadPinFn(nullptr);
+    h.setReadFn(nullptr, nullptr);
+    if (r == Reader::Pin)
+        h.setReadPinFn(readPin);
+    else if (r == Reader::Ctx)
+        h.setReadFn(readCtx, levels);
+    else if (r == Reader::Bank)
+        h.setReadBankFn(readBank, levels);
+    h.reset();
+
+    constexpr size_t kWordsN = (N + 31) / 32;
+    const uint32_t scans = (kWork / N < 100u) ? 100u : kWork / N;
+
+    // Trace generation alone, to subtract below.
+    rng = 0x12345678UL;
+    uint32_t t0 = nowNs();
+    for (uint32_t s = 0; s < scans; ++s)
+        fillLevels(t, s, kWordsN);
+    const uint32_t baseNs = nowNs() - t0;
+
+    rng = 0x12345678UL;
+    t0 = nowNs();
+    const uint32_t c0 = cycles();
+    for (uint32_t s = 0; s < scans; ++s)
+    {
+        fillLevels(t, s, kWordsN);
+        h.update(++virtualMs);
+    }
+    const uint32_t dc = cycles() - c0;
+    const uint32_t dt = nowNs() - t0;
+
+    (void)h.getPressType(0); ///< Keep events from being optimised away.
+
+    const float ns = (dt > baseNs ? static_cast<float>(dt - baseNs) : 0.0f) / static_cast<float>(scans);
+    out(static_cast<uint32_t>(N));
+    out(",");
+    out(kReaderNames[static_cast<uint8_t>(r)]);
+    out(",");
+    out(kTraceNames[static_cast<uint8_t>(t)]);
+    out(",");
+    out(ns);
+    out(",");
+    if (BENCH_HAS_CYCLES)
+        out(static_cast<float>(dc) / static_cast<float>(scans)); ///< Includes trace generation.
+    else
+        out("-");
+    outln();
+}
+
+template <size_t N>
+static void runSize()
+{
+    static uint8_t keys[N];
+    for (size_t i = 0; i < N; ++i)
+        keys[i] = ButtonPins::BenchPin;
+
+    static ButtonHandler<N> h(keys, readPin, ButtonTimingConfig{20, 200, 800, 300}, /*skipPinInit=*/true);
+    for (uint8_t r = 0; r < 4; ++r)
+        for (uint8_t t = 0; t < 3; ++t)
+        {
+            // Native GPIO cannot replay a trace; it always reads the real pin.
+            if (static_cast<Reader>(r) == Reader::Native && t != 0)
+                continue;
+            measure(h, static_cast<Reader>(r), static_cast<Trace>(t));
+        }
+}
+
+static void runAll()
+{
+    out("N,reader,trace,ns_per_update,cycles_per_update");
+    outln();
+#define X(n) runSize<n>();
+    BENCH_SIZES(X)
+#undef X
+}
+
+#if defined(ARDUINO)
+void setup()
+{
+    Serial.begin(115200);
+    delay(50);
+    pinMode(ButtonPins::BenchPin, INPUT_PULLUP);
+    cyclesInit();
+    out("Universal_Button " UNIVERSAL_BUTTON_VERSION " update() benchmark");
+    outln();
+    runAll();
+}
+
+void loop()
+{
+}
+#else
+int main()
+{
+    cyclesInit();
+    runAll();
+    return 0;
+}
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file 14_Event_Callbacks.ino
+ *
+ * @brief Event and latch callbacks: update() calls back the moment an event is
+ *        finalized or a latch changes, so loop() never polls the buttons.
+ */
+
+// Explicit button mapping (compile-time). MUST be BEFORE <Universal_Button> header include.
+#define BUTTON_LIST(X) \
+    X(Play, 4)         \
+    X(Mute, 5)         \
+    X(Power, 6)
+
+#include <Arduino.h>
+#include <Universal_Button.h>
+
+static Button btns = makeButtons();
+
+static const char *const kNames[] = {"Play", "Mute", "Power"};
+
+/**
+ * Called from update() for every Short/Long/Double/Repeat.
+ */
+static void onEvent(void *, const ButtonEvent &ev)
+{
+    Serial.print(kNames[ev.index]);
+    switch (ev.type)
+    {
+    case ButtonPressType::Short:
+        Serial.print(": short");
+        break;
+    case ButtonPressType::Long:
+        Serial.print(": long");
+        break;
+    case ButtonPressType::Double:
+        Serial.print(": double");
+        break;
+    default:
+        Serial.print(": other");
+        break;
+    }
+    Serial.print(" (");
+    Serial.print(ev.duration);
+    Serial.println(" ms)");
+}
+
+/**
+ * Functor with state: counts Mute toggles and reports every latch edge.
+ */
+struct LatchLogger
+{
+    uint16_t toggles = 0;
+
+    void operator()(uint8_t id, bool on)
+    {
+        ++toggles;
+        Serial.print(kNames[id]);
+        Serial.print(on ? F(" latched ON") : F(" latched OFF"));
+        Serial.print(F(", edges so far: "));
+        Serial.println(toggles);
+    }
+};
+
+static LatchLogger latchLog;
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(50);
+
+    // Mute toggles on every Short.
+    ButtonPerConfig pc{};
+    pc.latch_enabled = true;
+    pc.latch_mode = LatchMode::Toggle;
+    pc.latch_on = LatchTrigger::Short;
+    btns.setPerConfig(ButtonIndex::Mute, pc);
+
+    btns.setEventFn(onEvent, nullptr);
+    btns.setLatchHandler(latchLog);
+}
+
+void loop()
+{
+    btns.update(); ///< Callbacks run in here.
+
+    // setLatched()/clearAllLatched() edges go to the latch callback as well.
+    static bool powerWasPressed = false;
+    const bool powerPressed = btns.isPressed(ButtonIndex::Power);
+    if (powerPressed && !powerWasPressed)
+        btns.clearAllLatched();
+    powerWasPressed = powerPressed;
+
+    delay(1);
+}
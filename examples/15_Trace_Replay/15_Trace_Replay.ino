@@ -0,0 +1,431 @@
+/**
+ * @file 15_Trace_Replay.ino
+ *
+ * @brief Record raw button edges on the device, replay them through the classifier
+ *        on a desktop.
+ *
+ * On target the sketch is the recorder: it prints every raw level change of the
+ * BUTTON_LIST pins as one CSV line, and the events the handler produces as comments:
+ *
+ *     # time_ms,button,level
+ *     10234,0,1
+ *     10236,0,0
+ *     10237,0,1
+ *     # event 10535,0,Short,301
+ *
+ * Save the serial log to a file. The same sketch builds natively and replays such a
+ * trace with update(now) at a fixed scan period, as fast as the host allows:
+ *
+ *     g++ -std=c++17 -O2 -x c++ -Isrc examples/15_Trace_Replay/15_Trace_Replay.ino -o ub_replay
+ *     ./ub_replay trace.csv                       # event stream: timestamp,button,type,duration
+ *     ./ub_replay trace.csv > golden.csv          # record a golden file
+ *     ./ub_replay --golden golden.csv trace.csv   # exit 1 and show the first difference
+ *     ./ub_replay --bench 100 trace.csv           # replay 100 times, report throughput
+ *
+ * test/CMakeLists.txt runs the golden comparison on test/trace/press_mix.csv under ctest.
+ *
+ * Options: --timing debounce,short,long,double[,repeat_delay,interval,accel,min] (ms)
+ * and --scan <ms> (scan period, default 1). Builds with the matching option also take
+ * --edges (feed edges through onEdgeISR() with their own timestamps, UB_EDGE_QUEUE_SIZE),
+ * --adaptive min,max (setAdaptiveDebounce(), UB_ADAPTIVE_DEBOUNCE) and --chord mask,hold
+ * (addChordMask(), UB_CHORDS). A trace is either the CSV above (lines
+ * starting with '#' are ignored) or a binary file: the magic "UBT1" followed by 6-byte
+ * records (uint32 time_ms little-endian, uint8 button, uint8 level). Times must not go
+ * backwards; level 1 = pressed. Debouncing, classification and latching are identical
+ * on both sides because the replay runs the library code unchanged.
+ */
+
+// Buttons to record on target. MUST be BEFORE <Universal_Button> header include.
+#define BUTTON_LIST(X) \
+    X(Record0, 4)      \
+    X(Record1, 5)
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#endif
+#include <Universal_Button.h>
+
+static const char *const kTypeNames[] = {"None", "Short", "Long", "Double", "Repeat", "Chord"};
+
+#if defined(ARDUINO)
+
+// ---- Recorder (target) ---- //
+
+static Button btns = makeButtons();
+static bool levels[NUM_BUTTONS];
+
+static void onEvent(void *, const ButtonEvent &ev)
+{
+    Serial.print(F("# event "));
+    Serial.print(ev.timestamp);
+    Serial.print(',');
+    Serial.print(ev.index);
+    Serial.print(',');
+    Serial.print(kTypeNames[static_cast<uint8_t>(ev.type)]);
+    Serial.print(',');
+    Serial.println(ev.duration);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(50);
+    btns.setEventFn(onEvent, nullptr);
+    Serial.println(F("# time_ms,button,level"));
+}
+
+void loop()
+{
+    const uint32_t now = millis();
+    for (uint8_t i = 0; i < NUM_BUTTONS; ++i)
+    {
+        const bool pressed = digitalRead(BUTTON_PINS[i]) == LOW; ///< INPUT_PULLUP wiring.
+        if (pressed == levels[i])
+            continue;
+        levels[i] = pressed;
+        Serial.print(now);
+        Serial.print(',');
+        Serial.print(i);
+        Serial.print(',');
+        Serial.println(pressed ? 1 : 0);
+    }
+    btns.update(now);
+}
+
+#else
+
+// ---- Replay (host) ---- //
+
+/**
+ * One raw level change.
+ */
+struct Edge
+{
+    uint32_t t;
+    uint8_t id;
+    uint8_t level;
+};
+
+/**
+ * Replay settings and results.
+ */
+struct Replay
+{
+    ButtonTimingConfig timing{};
+    uint32_t scan = 1;
+    bool edges = false;      ///< Queue edges with onEdgeISR() instead of polling the reader.
+    uint32_t adapt[2] = {};  ///< Adaptive debounce bounds (min, max); max 0 = off.
+    uint32_t chord[2] = {};  ///< Chord mask and hold time; mask 0 = none.
+    bool keep = true;    ///< Collect the event stream (off while benchmarking).
+    std::string out;     ///< Event stream, one CSV line per event.
+    uint32_t events = 0; ///< Events seen.
+    uint32_t updates = 0;
+};
+
+static uint32_t levels[8]; ///< Raw pressed bits fed to the bank reader (up to 256 buttons).
+
+static void readBank(void *, uint32_t *words, size_t nwords)
+{
+    for (size_t w = 0; w < nwords; ++w)
+        words[w] = levels[w];
+}
+
+static void onEvent(void *ctx, const ButtonEvent &ev)
+{
+    Replay &r = *static_cast<Replay *>(ctx);
+    ++r.events;
+    if (!r.keep)
+        return;
+    char line[64];
+    snprintf(line, sizeof line, "%lu,%u,%s,%lu\n", static_cast<unsigned long>(ev.timestamp), ev.index,
+             kTypeNames[static_cast<uint8_t>(ev.type)], static_cast<unsigned long>(ev.duration));
+    r.out += line;
+}
+
+/**
+ * Feed the trace to a fresh handler, one update() per scan period, until every edge is
+ * applied and nothing is left pending (or a minute after the last edge).
+ */
+template <size_t N>
+static void run(const std::vector<Edge> &trace, Replay &r)
+{
+    static uint8_t keys[N];
+    ButtonHandler<N> h(keys, readBank, nullptr, r.timing, /*skipPinInit=*/true);
+    h.setEventFn(onEvent, &r);
+#if UB_EDGE_QUEUE_SIZE > 0
+    h.setEdgeMode(r.edges);
+#endif
+#if UB_ADAPTIVE_DEBOUNCE
+    if (r.adapt[1])
+        h.setAdaptiveDebounce(r.adapt[0], r.adapt[1]);
+#endif
+#if UB_CHORDS > 0
+    if (r.chord[0])
+        h.addChordMask(r.chord[0], r.chord[1]);
+#endif
+    memset(levels, 0, sizeof levels);
+
+    const uint32_t start = trace.empty() ? 0U : trace.front().t;
+    const uint32_t stop = (trace.empty() ? 0U : trace.back().t) + 60000U;
+    size_t next = 0;
+    h.update(start);
+    ++r.updates;
+    for (uint32_t t = start + r.scan;; t += r.scan)
+    {
+        for (; next < trace.size() && trace[next].t <= t; ++next)
+        {
+            const Edge &e = trace[next];
+            const uint32_t bit = static_cast<uint32_t>(1u) << (e.id & 31u);
+            levels[e.id >> 5] = e.level ? (levels[e.id >> 5] | bit) : (levels[e.id >> 5] & ~bit);
+#if UB_EDGE_QUEUE_SIZE > 0
+            if (r.edges)
+                h.onEdgeISR(e.id, e.level != 0u, e.t); // levels stay current for re-seeds after an overflow
+#endif
+        }
+        h.update(t);
+        ++r.updates;
+        if (next == trace.size() && (h.nextDeadline(t) == UB::kNoDeadline || static_cast<int32_t>(t - stop) >= 0))
+            break;
+    }
+}
+
+static void replay(const std::vector<Edge> &trace, uint8_t maxId, Replay &r)
+{
+    if (maxId < 8)
+        run<8>(trace, r);
+    else if (maxId < 32)
+        run<32>(trace, r);
+    else if (maxId < 64)
+        run<64>(trace, r);
+    else
+        run<255>(trace, r);
+}
+
+/**
+ * Load a CSV or binary trace; returns false (with a message) on malformed input.
+ */
+static bool load(const char *path, std::vector<Edge> &trace, uint8_t &maxId)
+{
+    FILE *f = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    if (!f)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+
+    char magic[4] = {};
+    const bool binary = fread(magic, 1, 4, f) == 4 && memcmp(magic, "UBT1", 4) == 0;
+    bool ok = true;
+    if (binary)
+    {
+        uint8_t rec[6];
+        while (fread(rec, 1, sizeof rec, f) == sizeof rec)
+        {
+            const uint32_t t = rec[0] | (static_cast<uint32_t>(rec[1]) << 8) | (static_cast<uint32_t>(rec[2]) << 16) |
+                               (static_cast<uint32_t>(rec[3]) << 24);
+            trace.push_back(Edge{t, rec[4], static_cast<uint8_t>(rec[5] != 0u)});
+        }
+    }
+    else
+    {
+        std::string text(magic, 4);
+        char buf[256];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof buf, f)) > 0)
+            text.append(buf, n);
+
+        size_t lineNo = 0;
+        for (size_t pos = 0; ok && pos < text.size();)
+        {
+            size_t end = text.find('\n', pos);
+            if (end == std::string::npos)
+                end = text.size();
+            const std::string line = text.substr(pos, end - pos);
+            pos = end + 1;
+            ++lineNo;
+            if (line.empty() || line[0] == '#' || line[0] == '\r')
+                continue;
+
+            unsigned long t, id, level;
+            if (sscanf(line.c_str(), "%lu,%lu,%lu", &t, &id, &level) != 3 || id > 254)
+            {
+                fprintf(stderr, "%s:%lu: expected time_ms,button,level\n", path, static_cast<unsigned long>(lineNo));
+                ok = false;
+                break;
+            }
+            trace.push_back(Edge{static_cast<uint32_t>(t), static_cast<uint8_t>(id), static_cast<uint8_t>(level != 0)});
+        }
+    }
+    if (f != stdin)
+        fclose(f);
+
+    maxId = 0;
+    for (size_t k = 0; ok && k < trace.size(); ++k)
+    {
+        if (k && static_cast<int32_t>(trace[k].t - trace[k - 1].t) < 0)
+        {
+            fprintf(stderr, "%s: time goes backwards at edge %lu\n", path, static_cast<unsigned long>(k));
+            ok = false;
+        }
+        if (trace[k].id > maxId)
+            maxId = trace[k].id;
+    }
+    return ok;
+}
+
+static bool parseTiming(const char *s, ButtonTimingConfig &t)
+{
+    unsigned long v[8];
+    const int n = sscanf(s, "%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6], &v[7]);
+    if (n < 4)
+        return false;
+    uint32_t *fields[8] = {&t.debounce_ms, &t.short_press_ms, &t.long_press_ms, &t.double_click_ms,
+                           &t.repeat_delay_ms, &t.repeat_interval_ms, &t.repeat_accel_ms, &t.repeat_min_ms};
+    for (int k = 0; k < n; ++k)
+        *fields[k] = static_cast<uint32_t>(v[k]);
+    return true;
+}
+
+/**
+ * Parse "a,b" into v[0], v[1].
+ */
+static bool parsePair(const char *s, uint32_t (&v)[2])
+{
+    unsigned long a, b;
+    if (sscanf(s, "%lu,%lu", &a, &b) != 2)
+        return false;
+    v[0] = static_cast<uint32_t>(a);
+    v[1] = static_cast<uint32_t>(b);
+    return true;
+}
+
+/**
+ * Compare the event stream with a golden file; prints the first differing line.
+ */
+static bool matchesGolden(const std::string &got, const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+    {
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+    std::string want;
+    char buf[256];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof buf, f)) > 0)
+        want.append(buf, n);
+    fclose(f);
+
+    if (got == want)
+        return true;
+    size_t pos = 0, start = 0, line = 1; ///< First difference, and the start of its line.
+    while (pos < got.size() && pos < want.size() && got[pos] == want[pos])
+    {
+        if (got[pos++] == '\n')
+        {
+            ++line;
+            start = pos;
+        }
+    }
+    const size_t a = want.find('\n', start), b = got.find('\n', start);
+    fprintf(stderr, "golden mismatch at line %lu\n", static_cast<unsigned long>(line));
+    fprintf(stderr, "  expected: %s\n", want.substr(start, (a == std::string::npos ? want.size() : a) - start).c_str());
+    fprintf(stderr, "  got:      %s\n", got.substr(start, (b == std::string::npos ? got.size() : b) - start).c_str());
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    Replay r;
+    const char *golden = nullptr;
+    const char *path = nullptr;
+    unsigned long bench = 0;
+    for (int k = 1; k < argc; ++k)
+    {
+        if (strcmp(argv[k], "--golden") == 0 && k + 1 < argc)
+            golden = argv[++k];
+        else if (strcmp(argv[k], "--bench") == 0 && k + 1 < argc)
+            bench = strtoul(argv[++k], nullptr, 10);
+        else if (strcmp(argv[k], "--scan") == 0 && k + 1 < argc)
+            r.scan = static_cast<uint32_t>(strtoul(argv[++k], nullptr, 10));
+        else if (strcmp(argv[k], "--timing") == 0 && k + 1 < argc)
+        {
+            if (!parseTiming(argv[++k], r.timing))
+            {
+                fprintf(stderr, "--timing needs at least debounce,short,long,double\n");
+                return 2;
+            }
+        }
+        else if (strcmp(argv[k], "--edges") == 0 && UB_EDGE_QUEUE_SIZE > 0)
+            r.edges = true;
+        else if (strcmp(argv[k], "--adaptive") == 0 && UB_ADAPTIVE_DEBOUNCE && k + 1 < argc)
+        {
+            if (!parsePair(argv[++k], r.adapt))
+            {
+                fprintf(stderr, "--adaptive needs min,max\n");
+                return 2;
+            }
+        }
+        else if (strcmp(argv[k], "--chord") == 0 && UB_CHORDS > 0 && k + 1 < argc)
+        {
+            if (!parsePair(argv[++k], r.chord))
+            {
+                fprintf(stderr, "--chord needs mask,hold\n");
+                return 2;
+            }
+        }
+        else if (!path)
+            path = argv[k];
+        else
+            path = nullptr, k = argc; ///< Too many arguments.
+    }
+    if (!path || r.scan == 0)
+    {
+        fprintf(stderr,
+                "usage: %s [--timing d,s,l,dc[,rd,ri,ra,rm]] [--scan ms] [--edges] [--adaptive min,max]\n"
+                "       [--chord mask,hold] [--golden file] [--bench runs] trace\n",
+                argv[0]);
+        return 2;
+    }
+
+    std::vector<Edge> trace;
+    uint8_t maxId = 0;
+    if (!load(path, trace, maxId))
+        return 2;
+
+    replay(trace, maxId, r);
+    if (golden)
+    {
+        if (!matchesGolden(r.out, golden))
+            return 1;
+        fprintf(stderr, "golden OK: %lu events\n", static_cast<unsigned long>(r.events));
+    }
+    else if (!bench)
+        fputs(r.out.c_str(), stdout);
+
+    if (bench)
+    {
+        Replay b = r;
+        b.keep = false;
+        b.events = 0;
+        b.updates = 0;
+        using namespace std::chrono;
+        const auto t0 = steady_clock::now();
+        for (unsigned long k = 0; k < bench; ++k)
+            replay(trace, maxId, b);
+        const double s = duration<double>(steady_clock::now() - t0).count();
+        fprintf(stderr, "%lu runs in %.3f s: %.0f updates/s, %.0f edges/s, %.0f events/s (%.1f ns/update)\n", bench, s,
+                b.updates / s, static_cast<double>(trace.size()) * bench / s, b.events / s, s * 1e9 / b.updates);
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,164 @@
+/**
+ * MIT License
+ *
+ * @brief Double-buffered snapshot adapter for non-blocking / DMA bus reads.
+ *
+ * @file AsyncReader.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-14
+ * @copyright Copyright © 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <ButtonCompatibility.h>
+
+/**
+ * @brief Overlaps expander/bus transfers with debouncing using two snapshot buffers.
+ *
+ * poll() swaps in the most recently completed transfer (if any) and immediately
+ * starts the next one into the other buffer, so update() always debounces the
+ * previous snapshot while the bus works in the background. Exactly one transfer
+ * is in flight at a time; the completion side only touches the back buffer.
+ * The hand-off is fenced with UB_MEMORY_BARRIER(), so the completion callback may
+ * run on another core.
+ *
+ * Wire it up with:
+ *  - StartFn: begin a non-blocking read of @p len bytes into @p dst (e.g. an
+ *    I2C/SPI DMA register read). Return false if the transfer could not start.
+ *  - onTransferComplete(): call from the driver's completion callback/ISR.
+ *
+ * @tparam Bytes Raw snapshot size in bytes (e.g. 2 for one MCP23017 GPIOAB read).
+ */
+template <size_t Bytes>
+class AsyncReader
+{
+    static_assert(Bytes > 0, "AsyncReader: Bytes must be greater than 0.");
+
+public:
+    /**
+     * @brief Start a non-blocking transfer into @p dst.
+     * @param ctx Opaque context.
+     * @param dst Back buffer to fill (valid until onTransferComplete()).
+     * @param len Number of bytes to read (== Bytes).
+     * @return true if the transfer was started.
+     */
+    using StartFn = bool (*)(void *ctx, uint8_t *dst, size_t len);
+
+    /**
+     * @brief Construct the adapter.
+     * @param start Transfer starter (see StartFn).
+     * @param ctx Opaque pointer passed back to @p start.
+     * @param idle Byte used to fill both buffers before the first transfer completes
+     *             (0xFF = "all released" for pull-up wiring).
+     */
+    AsyncReader(StartFn start, void *ctx, uint8_t idle = 0xFF) noexcept
+        : start_fn_(start), ctx_(ctx)
+    {
+        for (size_t b = 0; b < Bytes; ++b)
+        {
+            buf_[0][b] = idle;
+            buf_[1][b] = idle;
+        }
+    }
+
+    /**
+     * @brief Swap in a completed snapshot and kick off the next transfer.
+     * @return true if a new snapshot became current during this call.
+     * @note Call once per loop before update(), or from inside a ReadBankFn.
+     */
+    bool poll() noexcept
+    {
+        bool swapped = false;
+        if (!busy_)
+        {
+            UB_MEMORY_BARRIER();
+            if (ready_)
+            {
+                front_ ^= 1u;
+                ready_ = false;
+                swapped = true;
+            }
+
+            busy_ = true;
+            UB_MEMORY_BARRIER();
+            if (!start_fn_ || !start_fn_(ctx_, buf_[front_ ^ 1u], Bytes))
+                busy_ = false;
+        }
+
+        if (swapped)
+            stale_ = 0;
+        else if (stale_ != 0xFFFFu)
+            ++stale_;
+        return swapped;
+    }
+
+    /**
+     * @brief Mark the in-flight transfer finished (call from the completion callback/ISR).
+     * @param ok false => the transfer failed; the current snapshot is kept.
+     */
+    void onTransferComplete(bool ok = true) noexcept
+    {
+        UB_MEMORY_BARRIER();
+        ready_ = ok;
+        UB_MEMORY_BARRIER();
+        busy_ = false;
+    }
+
+    /**
+     * @brief Current snapshot (stable between poll() calls).
+     */
+    [[nodiscard]] const uint8_t *snapshot() const noexcept { return buf_[front_]; }
+
+    /**
+     * @brief Assemble up to four snapshot bytes into a little-endian word.
+     * @param offset First byte (e.g. 0 => GPIOA in bits 0..7, GPIOB in bits 8..15).
+     * @param count Bytes to assemble (1..4, clipped to the snapshot).
+     * @return Port word suitable for UB::util::gatherPortBits().
+     */
+    [[nodiscard]] uint32_t word(size_t offset = 0, size_t count = 4) const noexcept
+    {
+        uint32_t v = 0U;
+        const uint8_t *s = buf_[front_];
+        for (size_t b = 0; b < count && b < 4 && (offset + b) < Bytes; ++b)
+            v |= static_cast<uint32_t>(s[offset + b]) << (8u * b);
+        return v;
+    }
+
+    /**
+     * @brief Test one bit of the current snapshot.
+     * @param bit Bit index (byte bit / 8, bit bit % 8).
+     * @return true if the bit is 1.
+     */
+    [[nodiscard]] bool bit(size_t bit) const noexcept
+    {
+        return (bit >> 3) < Bytes && ((buf_[front_][bit >> 3] >> (bit & 7u)) & 1u) != 0u;
+    }
+
+    /**
+     * @brief ReadFn thunk: key = snapshot bit index, pressed when the bit reads LOW.
+     * @param ctx Pointer to this AsyncReader.
+     * @param key Snapshot bit index.
+     * @return true if pressed (pull-up wiring); false for keys beyond the snapshot.
+     * @note Per-key reads never start transfers; call poll() once per loop before update().
+     */
+    static bool readKeyLow(void *ctx, uint8_t key) noexcept
+    {
+        return (static_cast<size_t>(key) >> 3) < Bytes && !static_cast<const AsyncReader *>(ctx)->bit(key);
+    }
+
+    /**
+     * @brief poll() calls since the current snapshot was swapped in.
+     * @return 0 right after a fresh snapshot (saturates at 65535).
+     */
+    [[nodiscard]] uint16_t staleCount() const noexcept { return stale_; }
+
+private:
+    StartFn start_fn_{nullptr};   ///< Transfer starter.
+    void *ctx_{nullptr};          ///< Opaque context for start_fn_.
+    uint8_t buf_[2][Bytes];       ///< Front (current) and back (in-flight) snapshots.
+    uint8_t front_{0};            ///< Index of the current snapshot.
+    volatile bool busy_{false};   ///< A transfer into the back buffer is in flight.
+    volatile bool ready_{false};  ///< Back buffer holds a completed transfer.
+    uint16_t stale_{0};           ///< poll() calls since the snapshot was last refreshed.
+};
@@ -0,0 +1,74 @@
+/**
+ * MIT License
+ *
+ * @brief Packed 32-bit word bitmap helpers shared by bulk readers and the handler.
+ *
+ * @file ButtonBits.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-14
+ * @copyright Copyright © 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace UB
+{
+    namespace bits
+    {
+        /**
+         * @brief Number of 32-bit words needed to hold @p n bits.
+         * @param n Number of bits (buttons).
+         * @return ceil(n / 32).
+         */
+        constexpr size_t wordsFor(size_t n) noexcept { return (n + 31u) / 32u; }
+
+        /**
+         * @brief Test bit @p i in a packed word bitmap.
+         * @param words Bitmap storage (bit i lives in words[i / 32]).
+         * @param i Bit index.
+         * @return true if the bit is set.
+         */
+        inline bool test(const uint32_t *words, size_t i) noexcept
+        {
+            return ((words[i >> 5] >> (i & 31u)) & 1u) != 0u;
+        }
+
+        /**
+         * @brief Set or clear bit @p i in a packed word bitmap.
+         * @param words Bitmap storage (bit i lives in words[i / 32]).
+         * @param i Bit index.
+         * @param v New bit value.
+         */
+        inline void assign(uint32_t *words, size_t i, bool v) noexcept
+        {
+            const uint32_t mask = (static_cast<uint32_t>(1u) << (i & 31u));
+            if (v)
+                words[i >> 5] |= mask;
+            else
+                words[i >> 5] &= ~mask;
+        }
+
+        /**
+         * @brief Index of the lowest set bit in a non-zero word.
+         * @param v Word to scan; must not be 0.
+         * @return 0..31.
+         */
+        inline uint8_t lowestSet(uint32_t v) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<uint8_t>(__builtin_ctzl(static_cast<unsigned long>(v))); // unsigned int is 16-bit on AVR
+#else
+            uint8_t n = 0;
+            while ((v & 1u) == 0u)
+            {
+                v >>= 1;
+                ++n;
+            }
+            return n;
+#endif
+        }
+    } // namespace bits
+} // namespace UB
@@ -51,6 +51,45 @@
 #define UB_HAS_STD_BITSET 0
 #endif
 
+/**
+ * @brief Compiler-level memory barrier used to order ISR/main-loop shared accesses on one core.
+ * @note Does not emit a hardware fence; cross-core sharing needs real atomics.
+ */
+#ifndef UB_COMPILER_BARRIER
+#if defined(__GNUC__) || defined(__clang__)
+#define UB_COMPILER_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define UB_COMPILER_BARRIER() ((void)0)
+#endif
+#endif
+
+/**
+ * @brief Full hardware memory fence for data shared between cores (e.g. ESP32, RP2040).
+ * @note Falls back to UB_COMPILER_BARRIER() on compilers without __atomic builtins.
+ */
+#ifndef UB_MEMORY_BARRIER
+#if defined(__GNUC__) || defined(__clang__)
+#define UB_MEMORY_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+#define UB_MEMORY_BARRIER() UB_COMPILER_BARRIER()
+#endif
+#endif
+
+/**
+ * @brief Place a constant table in flash on AVR (PROGMEM); no-op elsewhere.
+ * @note Read such tables with UB_PGM_BYTE().
+ */
+#ifndef UB_PROGMEM
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define UB_PROGMEM PROGMEM
+#define UB_PGM_BYTE(p) pgm_read_byte(p)
+#else
+#define UB_PROGMEM
+#define UB_PGM_BYTE(p) (*(p))
+#endif
+#endif
+
 namespace UB
 {
     namespace compat
@@ -127,6 +166,25 @@ namespace UB
 
 #endif // UB_HAS_TYPE_TRAITS
 
+        /**
+         * @brief Select @p T when @p B is true, otherwise @p F (std::conditional without <type_traits>).
+         * @tparam B Compile-time boolean condition.
+         */
+        template <bool B, typename T, typename F>
+        struct conditional
+        {
+            using type = T;
+        };
+
+        /**
+         * @brief conditional specialization for false conditions.
+         */
+        template <typename T, typename F>
+        struct conditional<false, T, F>
+        {
+            using type = F;
+        };
+
         /**
          * @brief Lightweight fixed-size bitset replacement.
          *
@@ -202,5 +260,54 @@ namespace UB
             static constexpr size_t kBytes = (N + 7u) / 8u; ///< Number of bytes required to store N bits (ceil(N / 8)).
             uint8_t data_[kBytes];                          ///< Packed bit storage.
         };
+
+        // ---- Compile-time index sequences (C++11 stand-in for std::make_index_sequence) ---- //
+
+        /**
+         * @brief Pack of indices 0..N-1, used to expand constexpr tables.
+         * @tparam I Indices.
+         */
+        template <size_t... I>
+        struct index_sequence
+        {
+        };
+
+        namespace detail
+        {
+            template <typename A, typename B>
+            struct seq_cat;
+
+            template <size_t... A, size_t... B>
+            struct seq_cat<index_sequence<A...>, index_sequence<B...>>
+            {
+                using type = index_sequence<A..., (sizeof...(A) + B)...>;
+            };
+
+            /// Log-depth split keeps instantiation depth small for long sequences.
+            template <size_t N>
+            struct make_seq
+            {
+                using type = typename seq_cat<typename make_seq<N / 2>::type, typename make_seq<N - N / 2>::type>::type;
+            };
+
+            template <>
+            struct make_seq<0>
+            {
+                using type = index_sequence<>;
+            };
+
+            template <>
+            struct make_seq<1>
+            {
+                using type = index_sequence<0>;
+            };
+        } // namespace detail
+
+        /**
+         * @brief index_sequence<0, 1, ..., N-1>.
+         * @tparam N Sequence length.
+         */
+        template <size_t N>
+        using make_index_sequence = typename detail::make_seq<N>::type;
     } // namespace compat
 } // namespace UB
@@ -0,0 +1,177 @@
+/**
+ * MIT License
+ *
+ * @brief Scan scheduler that updates several button handlers from one clock read.
+ *
+ * @file ButtonGroup.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-14
+ * @copyright Copyright © 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <ButtonCompatibility.h>
+#include <ButtonBits.h>
+#include <ButtonTime.h>
+#include <IButtonHandler.h>
+
+/**
+ * @brief Fixed-capacity group of handlers scanned from one loop with per-member scan periods.
+ *
+ * update() reads the time once and calls update(now) on every member whose scan is due.
+ * A member with periodMs = 10 is scanned at 100 Hz no matter how often the loop runs;
+ * periodMs = 0 scans it on every group update(). Late scans do not burst to catch up.
+ *
+ * Timestamps (TimeFn, update(now), nextDeadline()) are ticks of @p Time and are passed
+ * to the members unchanged, so every member must use the same time base as the group
+ * (e.g. ButtonGroup<2, UB::time::Micros> for ButtonHandler<N, L, UB::time::Micros>).
+ * Scan periods are given in milliseconds and converted.
+ *
+ * @tparam M Maximum number of members (1..255).
+ * @tparam Time Time base shared with the members (UB::time::Millis or UB::time::Micros).
+ */
+template <size_t M, typename Time = UB_TIME_BASE>
+class ButtonGroup
+{
+    static_assert(M > 0 && M <= 255, "ButtonGroup<M>: M must be in 1..255.");
+
+public:
+    /**
+     * @brief Time function used by update(); nullptr uses Time::now() (::millis() by default).
+     * @note Returns ticks of the time base.
+     */
+    using TimeFn = uint32_t (*)();
+
+    /**
+     * @brief Construct an empty group.
+     * @param timeFn Optional time source (ticks). If nullptr, uses Time::now().
+     */
+    explicit ButtonGroup(TimeFn timeFn = nullptr) noexcept : time_fn_(timeFn) {}
+
+    /**
+     * @brief Add a member.
+     * @param h Handler to schedule (must outlive the group).
+     * @param periodMs Scan period (ms); 0 => every update().
+     * @return Member slot, or 0xFF if the group is full.
+     * @note The first scan happens on the next update().
+     */
+    uint8_t add(IButtonHandler &h, uint16_t periodMs = 0) noexcept
+    {
+        if (count_ >= M)
+            return 0xFF;
+        members_[count_] = &h;
+        period_[count_] = static_cast<uint32_t>(periodMs) * Time::kTicksPerMs;
+        UB::bits::assign(started_, count_, false);
+        return count_++;
+    }
+
+    /**
+     * @brief Change a member's scan period.
+     * @param slot Member slot returned by add().
+     * @param periodMs Scan period (ms); 0 => every update().
+     * @note Takes effect after the member's next scan.
+     */
+    void setPeriodMs(uint8_t slot, uint16_t periodMs) noexcept
+    {
+        if (slot < count_)
+            period_[slot] = static_cast<uint32_t>(periodMs) * Time::kTicksPerMs;
+    }
+
+    /**
+     * @brief Inject a time source.
+     * @param fn Function pointer: uint32_t() returning current time in ticks of Time.
+     */
+    void setTimeFn(TimeFn fn) noexcept { time_fn_ = fn; }
+
+    /**
+     * @brief Read the clock once and scan every member that is due.
+     * @return Number of members scanned.
+     */
+    uint8_t update() noexcept { return update(time_now()); }
+
+    /**
+     * @brief Scan every member that is due at @p now.
+     * @param now Current time (ticks).
+     * @return Number of members scanned.
+     */
+    uint8_t update(uint32_t now) noexcept
+    {
+        uint8_t scanned = 0;
+        for (uint8_t k = 0; k < count_; ++k)
+        {
+            const uint32_t p = period_[k];
+            if (p != 0u && UB::bits::test(started_, k) && static_cast<int32_t>(now - next_[k]) < 0)
+                continue;
+
+            members_[k]->update(now);
+            ++scanned;
+            if (p == 0u)
+                continue;
+
+            // Keep a steady cadence, but restart it after a stall instead of bursting.
+            const bool onTime = UB::bits::test(started_, k) && (now - next_[k]) < p;
+            next_[k] = onTime ? next_[k] + p : now + p;
+            UB::bits::assign(started_, k, true);
+        }
+        return scanned;
+    }
+
+    /**
+     * @brief Earliest time any member needs a scan, honouring scan periods.
+     * @param now Current time (ticks).
+     * @return Absolute deadline, @p now if a scan is due already, or UB::kNoDeadline.
+     * @note A member deadline earlier than its next scheduled scan is reported at the scan time.
+     *       Poll-mode members still need scans to notice new input; see IButtonHandler::nextDeadline().
+     */
+    [[nodiscard]] uint32_t nextDeadline(uint32_t now) const noexcept
+    {
+        uint32_t wait = UB::kNoDeadline;
+        for (uint8_t k = 0; k < count_; ++k)
+        {
+            if (period_[k] != 0u && !UB::bits::test(started_, k))
+                return now;
+
+            uint32_t due = members_[k]->nextDeadline(now);
+            if (due == UB::kNoDeadline)
+                continue;
+            if (period_[k] != 0u && static_cast<int32_t>(next_[k] - due) > 0)
+                due = next_[k];
+            UB::foldDeadline(wait, now, due);
+        }
+        return UB::deadlineAt(now, wait);
+    }
+
+    /**
+     * @brief Number of members.
+     */
+    [[nodiscard]] uint8_t size() const noexcept { return count_; }
+
+    /**
+     * @brief Member handler by slot.
+     * @param slot Member slot returned by add().
+     * @return Handler pointer, or nullptr if slot is out of range.
+     */
+    [[nodiscard]] IButtonHandler *member(uint8_t slot) const noexcept
+    {
+        return (slot < count_) ? members_[slot] : nullptr;
+    }
+
+private:
+    IButtonHandler *members_[M]{};                       ///< Scheduled handlers.
+    uint32_t next_[M]{};                                 ///< Next scan time per member (periodic members).
+    uint32_t period_[M]{};                               ///< Scan period per member (ticks; 0 = every update).
+    uint32_t started_[UB::bits::wordsFor(M)]{};          ///< Member has been scanned at least once.
+    uint8_t count_{0};                                   ///< Members in use.
+    TimeFn time_fn_{nullptr};                            ///< Optional time source.
+
+    /**
+     * @brief Resolve the current time in ticks (TimeFn, else Time::now()).
+     */
+    inline uint32_t time_now() const noexcept
+    {
+        if (time_fn_)
+            return time_fn_();
+        return Time::now();
+    }
+};
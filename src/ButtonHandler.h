@@ -12,23 +12,156 @@
 #pragma once
 
 #include <ButtonCompatibility.h>
+#include <ButtonBits.h>
+#include <ButtonLayout.h>
+#include <ButtonTime.h>
 #include <ButtonTypes.h>
 #include <IButtonHandler.h>
 
+// ---- Debounce engine selection ---- //
+
+#define UB_DEBOUNCE_TIMED 0      ///< Per-button stable-for-debounce_ms timer (default).
+#define UB_DEBOUNCE_INTEGRATOR 1 ///< Word-parallel shift-register integrator over packed masks.
+
+/**
+ * @brief Debounce engine used by ButtonHandler<N>::update().
+ * @note UB_DEBOUNCE_INTEGRATOR commits a level after UB_DEBOUNCE_SAMPLES identical
+ *       consecutive scans, processed 32 buttons per word operation. The commit
+ *       decision then depends on scan cadence rather than debounce_ms.
+ */
+#ifndef UB_DEBOUNCE_ENGINE
+#define UB_DEBOUNCE_ENGINE UB_DEBOUNCE_TIMED
+#endif
+
+/**
+ * @brief Consecutive identical samples required by UB_DEBOUNCE_INTEGRATOR.
+ */
+#ifndef UB_DEBOUNCE_SAMPLES
+#define UB_DEBOUNCE_SAMPLES 4
+#endif
+
+// ---- Edge-driven input ---- //
+
+/**
+ * @brief Capacity of the ISR edge queue used by ButtonHandler<N>::onEdgeISR().
+ * @note 0 (default) compiles edge mode out. Otherwise must be a power of two in 2..128.
+ */
+#ifndef UB_EDGE_QUEUE_SIZE
+#define UB_EDGE_QUEUE_SIZE 0
+#endif
+
+// ---- Event queue ---- //
+
+/**
+ * @brief Capacity of the finalized-event FIFO read by ButtonHandler<N>::drainEvents().
+ * @note 0 (default) compiles the FIFO out. Otherwise must be a power of two in 2..128.
+ */
+#ifndef UB_EVENT_QUEUE_SIZE
+#define UB_EVENT_QUEUE_SIZE 0
+#endif
+
+// ---- Cross-core publication ---- //
+
+/**
+ * @brief Publish state for readers on another core (1) or keep single-core access (0, default).
+ * @note Requires UB_EVENT_QUEUE_SIZE > 0: events cross cores through the FIFO, which becomes
+ *       a fenced SPSC queue. Pressed/latched words are published after every update() into a
+ *       double-buffered snapshot read with readShared()/isPressedShared()/isLatchedShared().
+ */
+#ifndef UB_CONCURRENT
+#define UB_CONCURRENT 0
+#endif
+
+#if UB_CONCURRENT && UB_EVENT_QUEUE_SIZE == 0
+#error "UB_CONCURRENT requires UB_EVENT_QUEUE_SIZE > 0 (events are delivered through the FIFO)."
+#endif
+
+#if UB_CONCURRENT
+#define UB_SHARED_FENCE() UB_MEMORY_BARRIER() ///< Orders cross-core FIFO/snapshot accesses.
+#else
+#define UB_SHARED_FENCE() ((void)0)
+#endif
+
+// ---- Adaptive debounce ---- //
+
+/**
+ * @brief Learn each button's debounce window from its bounce bursts (1) or use debounce_ms as is (0, default).
+ * @note Timed engine only. Adds 4 bytes per button (8 with a sub-millisecond time base);
+ *       learning starts once ButtonHandler<N>::setAdaptiveDebounce() sets the bounds.
+ */
+#ifndef UB_ADAPTIVE_DEBOUNCE
+#define UB_ADAPTIVE_DEBOUNCE 0
+#endif
+
+#if UB_ADAPTIVE_DEBOUNCE && UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_INTEGRATOR
+#error "UB_ADAPTIVE_DEBOUNCE requires UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_TIMED."
+#endif
+
+// ---- Chords ---- //
+
+/**
+ * @brief Number of button combinations ButtonHandler<N>::addChord() can register (0..32).
+ * @note 0 (default) compiles the chord engine out.
+ */
+#ifndef UB_CHORDS
+#define UB_CHORDS 0
+#endif
+
+// ---- Diagnostics ---- //
+
+/**
+ * @brief Keep field-diagnostic counters in ButtonHandler<N> (1) or compile them out (0, default).
+ * @note Adds update() duration, per-button bounce counts, a press-duration histogram and
+ *       event-consumption latency, read with stats(). Costs two clock reads per update().
+ */
+#ifndef UB_STATS
+#define UB_STATS 0
+#endif
+
+// ---- State layout ---- //
+
+/**
+ * @brief Default layout policy for ButtonHandler<N> per-button state.
+ * @note UB::layout::SoA (default) or UB::layout::AoS. Applies to every handler built
+ *       by the Easy Header factories; ButtonHandler<N, Layout> can also pick one directly.
+ */
+#ifndef UB_STATE_LAYOUT
+#define UB_STATE_LAYOUT UB::layout::SoA
+#endif
+
 /**
  * @brief Generic multi-button handler (adaptable to any digital input source).
  *
  * Uses a template parameter for compile-time button count, performs
  * debouncing and classifies press events (short/long). Optimized for ESP32,
- * supporting both a fast per-pin reader and a context-aware reader callback.
+ * supporting a fast per-pin reader, a context-aware reader callback, and a
+ * bulk bank reader that samples every button in one call per update().
+ *
+ * Times are ticks of the time base @p Time: milliseconds by default, so the "ms" used
+ * throughout this file reads "ticks" with UB::time::Micros or a custom base.
  *
  * @tparam N Number of logical buttons handled by this instance.
+ * @tparam Layout Per-button state layout policy (UB::layout::SoA or UB::layout::AoS).
+ * @tparam Time Time base (UB::time::Millis or UB::time::Micros): tick unit and default clock.
  */
-template <size_t N> ///< Sets the number of buttons at compile time.
+template <size_t N, typename Layout = UB_STATE_LAYOUT, typename Time = UB_TIME_BASE> ///< Sets the number of buttons at compile time.
 class ButtonHandler : public IButtonHandler
 {
     static_assert(N > 0, "Button<N>: N must be greater than 0.");
     static_assert(N <= 255, "ButtonHandler<N>: N must be <= 255 to fit the uint8_t API.");
+    static_assert(UB_DEBOUNCE_SAMPLES >= 1 && UB_DEBOUNCE_SAMPLES <= 32,
+                  "ButtonHandler<N>: UB_DEBOUNCE_SAMPLES must be in 1..32.");
+#if UB_EDGE_QUEUE_SIZE > 0
+    static_assert(UB_EDGE_QUEUE_SIZE <= 128 && (UB_EDGE_QUEUE_SIZE & (UB_EDGE_QUEUE_SIZE - 1)) == 0,
+                  "ButtonHandler<N>: UB_EDGE_QUEUE_SIZE must be a power of two <= 128.");
+#endif
+#if UB_CHORDS > 0
+    static_assert(UB_CHORDS <= 32, "ButtonHandler<N>: UB_CHORDS must be <= 32.");
+#endif
+#if UB_EVENT_QUEUE_SIZE > 0
+    static_assert(UB_EVENT_QUEUE_SIZE <= 128 && (UB_EVENT_QUEUE_SIZE & (UB_EVENT_QUEUE_SIZE - 1)) == 0,
+                  "ButtonHandler<N>: UB_EVENT_QUEUE_SIZE must be a power of two <= 128.");
+#endif
 
 public:
     // ---- Types ---- //
@@ -49,12 +182,67 @@ public:
     using ReadFn = bool (*)(void *ctx, uint8_t id);
 
     /**
-     * @brief Time function to use for update(); nullptr uses ::millis() when Arduino is available.
+     * @brief Bulk reader callback that samples every button in one call.
+     * @param ctx Opaque user context pointer supplied at construction/setter.
+     * @param words Packed raw-state bitmap; bit i of words[i / 32] is logical button i (true = pressed).
+     * @param nwords Number of words in @p words (always kWords).
+     * @note The bitmap is zeroed before each call, so the reader only needs to set pressed bits.
+     *       Bits are indexed by logical button index, not by pin/key.
+     */
+    using ReadBankFn = void (*)(void *ctx, uint32_t *words, size_t nwords);
+
+    /**
+     * @brief Time function to use for update(); nullptr uses Time::now() (::millis() by default).
      * @note Signature is uint32_t() for easier cross-RTOS integration; millis() is implicitly narrowed.
-     *       Outside Arduino builds, provide TimeFn or call update(now_ms).
+     *       Returns ticks of the time base. Outside Arduino builds, provide TimeFn or call update(now_ms).
      */
     using TimeFn = uint32_t (*)();
 
+    /**
+     * @brief Event callback invoked from update() the moment an event is finalized.
+     * @param ctx Opaque user context pointer supplied to setEventFn().
+     * @param ev The event (same fields as a drainEvents() entry).
+     */
+    using EventFn = void (*)(void *ctx, const ButtonEvent &ev);
+
+    /**
+     * @brief Latch callback invoked whenever a button's latched state changes.
+     * @param ctx Opaque user context pointer supplied to setLatchFn().
+     * @param id Button index.
+     * @param latched New latched state.
+     */
+    using LatchFn = void (*)(void *ctx, uint8_t id, bool latched);
+
+#if UB_STATS
+    /**
+     * @brief Free-running tick counter for UB_STATS timings; nullptr uses ::micros() when Arduino is available.
+     * @note Any monotonic wrapping counter works, e.g. a CPU cycle counter (DWT->CYCCNT, ESP.getCycleCount()).
+     */
+    using CycleFn = uint32_t (*)();
+
+    /**
+     * @brief Diagnostic counters returned by stats().
+     */
+    struct Stats
+    {
+        ButtonStatSpan update_ticks;              ///< update() duration (stats-clock ticks).
+        ButtonStatSpan latency_ticks;             ///< Event finalized -> consumed by getPressType() (stats-clock ticks).
+        uint32_t press_hist[UB::kPressBuckets];   ///< Completed presses by duration: bucket k < (32 << k) ms, last = the rest.
+        uint16_t bounces[N];                      ///< Raw edges inside an open debounce window (saturates at 65535).
+    };
+#endif
+
+    /**
+     * @brief Number of 32-bit words in a packed per-button bitmap for this handler.
+     */
+    static constexpr size_t kWords = UB::bits::wordsFor(N);
+
+#if UB_ADAPTIVE_DEBOUNCE
+    /// Learned-window storage: 16 bits of ms, or 32 bits for finer ticks (as Compact's stamps).
+    using Learn = typename UB::compat::conditional<(Time::kTicksPerMs > 1u), uint32_t, uint16_t>::type;
+    static constexpr uint32_t kLearnMax = (Time::kTicksPerMs > 1u) ? 0xFFFFFFFFUL : 0xFFFFUL; ///< Largest learnable window.
+#endif
+
 public:
     // ---- Construction ---- //
 
@@ -64,33 +252,15 @@ public:
      * @param timing Global debounce/press-duration configuration.
      * @param skipPinInit If true, GPIO mode is not configured here. Set to true when pins are configured elsewhere.
      * @note Outside Arduino builds, prefer an external reader constructor and a TimeFn/update(now_ms).
-     * @param timeFn Optional time source (ms). If nullptr, uses millis() on Arduino.
+     * @param timeFn Optional time source (ticks). If nullptr, uses Time::now() (millis() by default).
      */
     ButtonHandler(const uint8_t (&buttonPins)[N],
-                  ButtonTimingConfig timing = {},
+                  ButtonTimingConfig timing = UB::time::defaultTiming<Time>(),
                   bool skipPinInit = false,
                   TimeFn timeFn = nullptr) noexcept
         : timing_{timing}, time_fn_{timeFn}
     {
-        const uint32_t t0 = time_now();
-        for (size_t i = 0; i < N; ++i)
-        {
-            pins_[i] = buttonPins[i];
-            if (!skipPinInit)
-                initPin_(pins_[i]);
-            last_state_[i] = false;
-            last_state_read_[i] = false;
-            last_state_change_[i] = t0;
-            press_start_[i] = 0;
-            has_press_start_[i] = false;
-            event_[i] = ButtonPressType::None;
-            per_[i] = ButtonPerConfig{};
-            last_duration_[i] = 0;
-            pending_short_[i] = false;
-            pending_since_[i] = 0;
-            latched_.set(i, per_[i].latch_initial);
-            latched_changed_.set(i, false);
-        }
+        init_(buttonPins, skipPinInit);
     }
 
     /**
@@ -99,34 +269,16 @@ public:
      * @param readPin Fast reader: bool(uint8_t id) returns pressed.
      * @param timing Global debounce/press-duration configuration.
      * @param skipPinInit If false, pins are set to INPUT_PULLUP here.
-     * @param timeFn Optional time source (ms). If nullptr, uses millis() on Arduino.
+     * @param timeFn Optional time source (ticks). If nullptr, uses Time::now() (millis() by default).
      */
     ButtonHandler(const uint8_t (&buttonPins)[N],
                   ReadPinFn readPin,
-                  ButtonTimingConfig timing = {},
+                  ButtonTimingConfig timing = UB::time::defaultTiming<Time>(),
                   bool skipPinInit = true,
                   TimeFn timeFn = nullptr) noexcept
         : timing_{timing}, read_pin_fn_{readPin}, time_fn_{timeFn}
     {
-        const uint32_t t0 = time_now();
-        for (size_t i = 0; i < N; ++i)
-        {
-            pins_[i] = buttonPins[i];
-            if (!skipPinInit)
-                initPin_(pins_[i]);
-            last_state_[i] = false;
-            last_state_read_[i] = false;
-            last_state_change_[i] = t0;
-            press_start_[i] = 0;
-            has_press_start_[i] = false;
-            event_[i] = ButtonPressType::None;
-            per_[i] = ButtonPerConfig{};
-            last_duration_[i] = 0;
-            pending_short_[i] = false;
-            pending_since_[i] = 0;
-            latched_.set(i, per_[i].latch_initial);
-            latched_changed_.set(i, false);
-        }
+        init_(buttonPins, skipPinInit);
     }
 
     /**
@@ -136,34 +288,35 @@ public:
      * @param ctx Pointer passed to readCb on each call.
      * @param timing Global debounce/press-duration configuration.
      * @param skipPinInit If false, pins are set to INPUT_PULLUP here.
-     * @param timeFn Optional time source (ms). If nullptr, uses millis() on Arduino.
+     * @param timeFn Optional time source (ticks). If nullptr, uses Time::now() (millis() by default).
      */
     ButtonHandler(const uint8_t (&buttonPins)[N],
                   ReadFn readCb, void *ctx,
-                  ButtonTimingConfig timing = {},
+                  ButtonTimingConfig timing = UB::time::defaultTiming<Time>(),
                   bool skipPinInit = true,
                   TimeFn timeFn = nullptr) noexcept
         : timing_{timing}, read_fn_{readCb}, read_ctx_{ctx}, time_fn_{timeFn}
     {
-        const uint32_t t0 = time_now();
-        for (size_t i = 0; i < N; ++i)
-        {
-            pins_[i] = buttonPins[i];
-            if (!skipPinInit)
-                initPin_(pins_[i]);
-            last_state_[i] = false;
-            last_state_read_[i] = false;
-            last_state_change_[i] = t0;
-            press_start_[i] = 0;
-            has_press_start_[i] = false;
-            event_[i] = ButtonPressType::None;
-            per_[i] = ButtonPerConfig{};
-            last_duration_[i] = 0;
-            pending_short_[i] = false;
-            pending_since_[i] = 0;
-            latched_.set(i, per_[i].latch_initial);
-            latched_changed_.set(i, false);
-        }
+        init_(buttonPins, skipPinInit);
+    }
+
+    /**
+     * @brief Construct with a bulk bank reader (one call per update()).
+     * @param buttonPins Reference to an array of length N with pin IDs.
+     * @param readBank Reader: void(void* ctx, uint32_t* words, size_t nwords) fills the pressed bitmap.
+     * @param ctx Pointer passed to readBank on each call.
+     * @param timing Global debounce/press-duration configuration.
+     * @param skipPinInit If false, pins are set to INPUT_PULLUP here.
+     * @param timeFn Optional time source (ticks). If nullptr, uses Time::now() (millis() by default).
+     */
+    ButtonHandler(const uint8_t (&buttonPins)[N],
+                  ReadBankFn readBank, void *ctx,
+                  ButtonTimingConfig timing = UB::time::defaultTiming<Time>(),
+                  bool skipPinInit = true,
+                  TimeFn timeFn = nullptr) noexcept
+        : timing_{timing}, read_bank_fn_{readBank}, bank_ctx_{ctx}, time_fn_{timeFn}
+    {
+        init_(buttonPins, skipPinInit);
     }
 
     // ---- Configuration setters ---- //
@@ -188,18 +341,108 @@ public:
     }
 
     /**
-     * @brief Inject a time source (milliseconds).
+     * @brief Set a bulk bank reader.
+     * @param fn Function pointer: void(void* ctx, uint32_t* words, size_t nwords) => pressed bitmap.
+     * @param ctx Opaque pointer passed back to fn on each read.
+     * @note When set, the bank reader takes precedence over the per-pin and context readers.
+     */
+    void setReadBankFn(ReadBankFn fn, void *ctx) noexcept
+    {
+        read_bank_fn_ = fn;
+        bank_ctx_ = ctx;
+    }
+
+    /**
+     * @brief Dispatch finalized events to a callback instead of the per-button slots.
+     * @param fn Function pointer: void(void* ctx, const ButtonEvent& ev); nullptr restores polling.
+     * @param ctx Opaque pointer passed back to fn on each event.
+     * @note While set, getPressType() and eventMask() see no events; the FIFO (if enabled) still
+     *       receives them. fn runs inside update(), on the scanning core under UB_CONCURRENT.
+     */
+    void setEventFn(EventFn fn, void *ctx) noexcept
+    {
+        event_fn_ = fn;
+        event_ctx_ = ctx;
+    }
+
+    /**
+     * @brief Dispatch events to a functor or captureless lambda: void f(const ButtonEvent&).
+     * @tparam F Callable type.
+     * @param f Callable (must outlive its registration).
+     */
+    template <typename F>
+    void setEventHandler(F &f) noexcept
+    {
+        setEventFn([](void *ctx, const ButtonEvent &ev)
+                   { (*static_cast<F *>(ctx))(ev); },
+                   &f);
+    }
+
+    /**
+     * @brief Dispatch latch edges to a callback instead of the getAndClearLatchedChanged() flags.
+     * @param fn Function pointer: void(void* ctx, uint8_t id, bool latched); nullptr restores polling.
+     * @param ctx Opaque pointer passed back to fn on each edge.
+     * @note Covers event-driven latching and setLatched()/clearAllLatched()/clearLatchedWords().
+     *       A latch edge caused by an event is dispatched before the event itself.
+     */
+    void setLatchFn(LatchFn fn, void *ctx) noexcept
+    {
+        latch_fn_ = fn;
+        latch_ctx_ = ctx;
+    }
+
+    /**
+     * @brief Dispatch latch edges to a functor or captureless lambda: void f(uint8_t id, bool latched).
+     * @tparam F Callable type.
+     * @param f Callable (must outlive its registration).
+     */
+    template <typename F>
+    void setLatchHandler(F &f) noexcept
+    {
+        setLatchFn([](void *ctx, uint8_t id, bool on)
+                   { (*static_cast<F *>(ctx))(id, on); },
+                   &f);
+    }
+
+    /**
+     * @brief Inject a time source (milliseconds, or ticks of a non-default time base).
      * @param fn Function pointer: uint32_t() returning current time in ms.
-     * @note If nullptr, uses Arduino ::millis() implicitly via time_now() when Arduino is available.
+     * @note If nullptr, uses Time::now() implicitly via time_now() (Arduino ::millis() by default).
      */
     void setTimeFn(TimeFn fn) noexcept { time_fn_ = fn; }
 
+#if UB_STATS
+    /**
+     * @brief Inject the tick counter used for update() and event-latency timings.
+     * @param fn Function pointer: uint32_t() returning a free-running tick count.
+     * @note If nullptr, uses Arduino ::micros() when Arduino is available (ticks = us); otherwise timings read 0.
+     */
+    void setStatsClock(CycleFn fn) noexcept { stats_clock_ = fn; }
+
+    /**
+     * @brief Diagnostic counters collected since construction or the last resetStats().
+     * @note Not cleared by reset(). With UB_CONCURRENT, read on the scanner core.
+     */
+    [[nodiscard]] const Stats &stats() const noexcept { return stats_; }
+
+    /**
+     * @brief Zero every diagnostic counter.
+     */
+    void resetStats() noexcept { stats_ = Stats{}; }
+#endif
+
     /**
      * @brief Override the global debounce/press-duration timings.
      * @param t New global timing configuration.
      * @note Per-button overrides (non-zero fields) still take precedence.
+     * @note Rebuilds the effective timing table for every button (configuration path only).
      */
-    void setGlobalTiming(const ButtonTimingConfig &t) noexcept { timing_ = t; }
+    void setGlobalTiming(const ButtonTimingConfig &t) noexcept
+    {
+        timing_ = t;
+        st_.resolveAll(timing_);
+        refreshFlagsAll_();
+    }
 
     /**
      * @brief Backward-compatible alias for setGlobalTiming().
@@ -213,22 +456,29 @@ public:
      * @note If c.enabled is false, debouncer/event state, pending double-click state,
      *       last duration, latched state, and latch-changed flag are cleared
      *       (same behavior as enable(id, false)).
-     * @note Silently ignored if id is out of range.
+     * @note The button stops following its profile (profileOf() returns UB::kCustomProfile).
+     * @return false if id is out of range, or if the UB::layout::Compact config table
+     *         has no free slot (the button keeps its previous configuration).
      */
-    void setPerConfig(uint8_t id, const ButtonPerConfig &c) noexcept
+    bool setPerConfig(uint8_t id, const ButtonPerConfig &c) noexcept
     {
-        if (id < N)
-        {
-            const bool was_enabled = per_[id].enabled;
-            per_[id] = c;
+        if (id >= N)
+            return false;
 
-            // Keep behavior consistent with enable(id, false): disabling clears runtime state.
-            if (was_enabled && !per_[id].enabled)
-                resetButton_(static_cast<size_t>(id), time_now());
+        const bool was_enabled = UB::bits::test(enabled_, id);
+        if (!st_.setConfig(static_cast<size_t>(id), c, timing_))
+            return false;
+        UB::bits::assign(enabled_, id, c.enabled);
+        UB::bits::assign(invert_, id, !c.active_low);
+        refreshFlags_(id);
 
-            // For enabled buttons, latched state is preserved at runtime.
-            // latch_initial is only applied on reset() (and at construction).
-        }
+        // Keep behavior consistent with enable(id, false): disabling clears runtime state.
+        if (was_enabled && !c.enabled)
+            resetButton_(static_cast<size_t>(id), time_now());
+
+        // For enabled buttons, latched state is preserved at runtime.
+        // latch_initial is only applied on reset() (and at construction).
+        return true;
     }
 
     /**
@@ -243,7 +493,7 @@ public:
     {
         if (id < N)
         {
-            per_[id].enabled = en;
+            UB::bits::assign(enabled_, id, en);
             if (!en)
             {
                 resetButton_(static_cast<size_t>(id), time_now());
@@ -260,183 +510,492 @@ public:
     void setActiveLow(uint8_t id, bool activeLow) noexcept
     {
         if (id < N)
-            per_[id].active_low = activeLow;
+        {
+            UB::bits::assign(invert_, id, !activeLow);
+        }
     }
 
     /**
-     * @brief Enum-friendly overload of setPerConfig().
-     * @tparam E  Enum type (e.g., ButtonIndex) with underlying uint8_t.
-     * @param e Enumerated button identifier.
-     * @param c Per-button overrides (0 => use global for timing fields).
-     * @note Inlines to the uint8_t overload; avoids casts at call sites.
+     * @brief Enable/disable buttons 0..31 selected by a bitmask.
+     * @param mask Bitmask of button indices to change.
+     * @param en true to enable; false to disable.
      */
-    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
-    void setPerConfig(E e, const ButtonPerConfig &c) noexcept
+    void enableMask(uint32_t mask, bool en) noexcept { enableWords(&mask, 1, en); }
+
+    /**
+     * @brief Enable/disable the buttons selected by a packed word mask in one pass.
+     * @param mask Word array (bit i of mask[i / 32] = button i).
+     * @param nwords Number of words in @p mask; buttons beyond it are untouched.
+     * @param en true to enable; false to disable.
+     * @note Same per-button effect as enable(), with one clock read for the whole batch;
+     *       buttons that are already disabled are not reset again.
+     */
+    void enableWords(const uint32_t *mask, size_t nwords, bool en) noexcept
     {
-        setPerConfig(static_cast<uint8_t>(e), c);
+        const size_t n = (nwords < kWords) ? nwords : kWords;
+        if (en)
+        {
+            for (size_t w = 0; w < n; ++w)
+                enabled_[w] |= mask[w] & validMask_(w);
+            return;
+        }
+
+        const uint32_t now = time_now();
+        for (size_t w = 0; w < n; ++w)
+        {
+            uint32_t off = mask[w] & enabled_[w];
+            enabled_[w] &= ~mask[w];
+            while (off)
+            {
+                resetButton_((w << 5) + UB::bits::lowestSet(off), now);
+                off &= off - 1u;
+            }
+        }
     }
 
     /**
-     * @brief Enum-friendly overload of enable().
+     * @brief Set the polarity of buttons 0..31 selected by a bitmask.
+     * @param mask Bitmask of button indices to change.
+     * @param activeLow true => LOW is pressed; false => HIGH is pressed.
+     */
+    void setActiveLowMask(uint32_t mask, bool activeLow) noexcept { setActiveLowWords(&mask, 1, activeLow); }
+
+    /**
+     * @brief Set the polarity of the buttons selected by a packed word mask.
+     * @param mask Word array (bit i of mask[i / 32] = button i).
+     * @param nwords Number of words in @p mask; buttons beyond it are untouched.
+     * @param activeLow true => LOW is pressed; false => HIGH is pressed.
+     */
+    void setActiveLowWords(const uint32_t *mask, size_t nwords, bool activeLow) noexcept
+    {
+        const size_t n = (nwords < kWords) ? nwords : kWords;
+        for (size_t w = 0; w < n; ++w)
+        {
+            const uint32_t m = mask[w] & validMask_(w);
+            invert_[w] = activeLow ? (invert_[w] & ~m) : (invert_[w] | m);
+        }
+    }
+
+    /**
+     * @brief Apply the same per-button overrides to buttons first..last (inclusive).
+     * @param first First button index.
+     * @param last Last button index (clamped to N-1).
+     * @param c Overrides (0 => use global for timing fields).
+     * @note Same per-button effect as setPerConfig(), with one clock read for the whole
+     *       range; with UB::layout::Compact the whole range shares one config slot.
+     * @return false if the range is empty/out of range, or if a UB::layout::Compact slot
+     *         could not be found (those buttons keep their previous configuration).
+     */
+    bool setPerConfigRange(uint8_t first, uint8_t last, const ButtonPerConfig &c) noexcept
+    {
+        if (first >= N || last < first)
+            return false;
+        const size_t end = (static_cast<size_t>(last) < N) ? static_cast<size_t>(last) : N - 1u;
+
+        bool ok = true;
+        const uint32_t now = time_now();
+        for (size_t i = first; i <= end; ++i)
+        {
+            const bool was_enabled = UB::bits::test(enabled_, i);
+            if (!st_.setConfig(i, c, timing_))
+            {
+                ok = false;
+                continue;
+            }
+            UB::bits::assign(enabled_, i, c.enabled);
+            UB::bits::assign(invert_, i, !c.active_low);
+            refreshFlags_(i);
+            if (was_enabled && !c.enabled)
+                resetButton_(i, now);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Enum-friendly overload of setPerConfigRange().
      * @tparam E Enum type (e.g., ButtonIndex) with underlying uint8_t.
-     * @param e Enumerated button identifier.
-     * @param en true to enable; false to disable.
-     * @note Inlines to the uint8_t overload; avoids casts at call sites.
+     * @param first First button.
+     * @param last Last button (inclusive).
+     * @param c Overrides.
+     * @return false on an empty range or a full Compact config table.
      */
     template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
-    void enable(E e, bool en) noexcept
+    bool setPerConfigRange(E first, E last, const ButtonPerConfig &c) noexcept
     {
-        enable(static_cast<uint8_t>(e), en);
+        return setPerConfigRange(static_cast<uint8_t>(first), static_cast<uint8_t>(last), c);
     }
 
     /**
-     * @brief Enum-friendly overload of setActiveLow().
-     * @tparam E Enum type (e.g., ButtonIndex) with underlying uint8_t.
+     * @brief Enum-friendly overload of setPerConfig().
+     * @tparam E  Enum type (e.g., ButtonIndex) with underlying uint8_t.
      * @param e Enumerated button identifier.
-     * @param activeLow true => LOW is pressed; false => HIGH is pressed.
+     * @param c Per-button overrides (0 => use global for timing fields).
      * @note Inlines to the uint8_t overload; avoids casts at call sites.
      */
     template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
-    void setActiveLow(E e, bool activeLow) noexcept
+    bool setPerConfig(E e, const ButtonPerConfig &c) noexcept
     {
-        setActiveLow(static_cast<uint8_t>(e), activeLow);
+        return setPerConfig(static_cast<uint8_t>(e), c);
     }
 
-    // ---- IButtonHandler overrides (core per-button API) ---- //
-
     /**
-     * @brief Number of logical buttons handled by this instance.
-     * @return Compile-time constant (N) as uint8_t.
+     * @brief Set the timing/latch behaviour of a named profile.
+     * @param p Profile index [0..UB_CONFIG_PROFILES-1]; profile 0 is what every button starts on.
+     * @param c Profile settings (0 => use global for timing fields).
+     * @return false if p is out of range.
+     * @note Every button following @p p picks the change up. O(N) on every layout: Compact
+     *       retunes the shared slot once, but each follower's behaviour bits are still rebuilt.
+     *       c.enabled / c.active_low are applied by setProfile(), not retroactively.
      */
-    [[nodiscard]] uint8_t size() const noexcept override { return static_cast<uint8_t>(N); }
+    bool defineProfile(uint8_t p, const ButtonPerConfig &c) noexcept
+    {
+        if (p >= UB_CONFIG_PROFILES)
+            return false;
+        st_.defineProfile(p, c, timing_);
+        for (size_t i = 0; i < N; ++i)
+        {
+            if (st_.profileOf(i) == p)
+                refreshFlags_(i);
+        }
+        return true;
+    }
 
     /**
-     * @brief Compile-time number of logical buttons.
-     * @return N as uint8_t.
+     * @brief Enum-friendly overload of defineProfile().
+     * @tparam P Enum type naming the profiles (underlying values 0..UB_CONFIG_PROFILES-1).
+     * @param p Enumerated profile.
+     * @param c Profile settings.
+     * @return false if p is out of range.
      */
-    [[nodiscard]] static constexpr uint8_t sizeStatic() noexcept { return static_cast<uint8_t>(N); }
+    template <typename P, UB::compat::enable_if_t<UB::compat::is_enum<P>::value, int> = 0>
+    bool defineProfile(P p, const ButtonPerConfig &c) noexcept
+    {
+        return defineProfile(static_cast<uint8_t>(p), c);
+    }
 
     /**
-     * @brief Iterate all debounced button states.
-     * @tparam F Callable with signature f(uint8_t index, bool pressed).
-     * @param f Callback invoked once per button.
+     * @brief Make a button follow a named profile.
+     * @param id Button index [0..N-1].
+     * @param p Profile index [0..UB_CONFIG_PROFILES-1].
+     * @return false if id or p is out of range.
+     * @note Applies the profile's enabled/active_low to this button, with the same
+     *       disable-clears-state rule as setPerConfig().
      */
-    template <typename F>
-    void forEach(F &&f) const noexcept
+    bool setProfile(uint8_t id, uint8_t p) noexcept
     {
-        for (size_t i = 0; i < N; ++i)
-            f(static_cast<uint8_t>(i), last_state_[i]);
+        if (id >= N || p >= UB_CONFIG_PROFILES)
+            return false;
+
+        const bool was_enabled = UB::bits::test(enabled_, id);
+        const ButtonPerConfig &c = st_.profile(p);
+        st_.setProfile(static_cast<size_t>(id), p, timing_);
+        UB::bits::assign(enabled_, id, c.enabled);
+        UB::bits::assign(invert_, id, !c.active_low);
+        refreshFlags_(id);
+        if (was_enabled && !c.enabled)
+            resetButton_(static_cast<size_t>(id), time_now());
+        return true;
     }
 
     /**
-     * @brief Scan and process button states using the configured time source.
+     * @brief Enum-friendly overload of setProfile().
+     * @tparam E Enum type (e.g., ButtonIndex) with underlying uint8_t.
+     * @tparam P Enum or integral profile index.
+     * @param e Enumerated button identifier.
+     * @param p Profile.
+     * @return false if e or p is out of range.
      */
-    void update() noexcept override { update(time_now()); }
+    template <typename E, typename P, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    bool setProfile(E e, P p) noexcept
+    {
+        return setProfile(static_cast<uint8_t>(e), static_cast<uint8_t>(p));
+    }
 
     /**
-     * @brief Scan and process button states using a provided timestamp.
-     * @param now Millisecond timestamp to use (e.g., from xTaskGetTickCount in RTOS).
+     * @brief Overload of setProfile() for a numeric button index and an enumerated profile.
+     * @tparam P Enum type naming the profiles.
+     * @param id Button index [0..N-1].
+     * @param p Enumerated profile.
+     * @return false if id or p is out of range.
      */
-    void update(uint32_t now) noexcept override
+    template <typename P, UB::compat::enable_if_t<UB::compat::is_enum<P>::value, int> = 0>
+    bool setProfile(uint8_t id, P p) noexcept
     {
-        for (size_t i = 0; i < N; ++i)
-        {
-            // Skip disabled buttons entirely.
-            if (!per_[i].enabled)
-                continue;
+        return setProfile(id, static_cast<uint8_t>(p));
+    }
 
-            // Resolve timing with per-button overrides (0 => fall back to global).
-            const uint32_t dms = per_[i].debounce_ms ? static_cast<uint32_t>(per_[i].debounce_ms) : timing_.debounce_ms;
-            const uint32_t sms = per_[i].short_press_ms ? static_cast<uint32_t>(per_[i].short_press_ms) : timing_.short_press_ms;
-            const uint32_t lms = per_[i].long_press_ms ? static_cast<uint32_t>(per_[i].long_press_ms) : timing_.long_press_ms;
-            const uint32_t dcms = per_[i].double_click_ms ? static_cast<uint32_t>(per_[i].double_click_ms) : timing_.double_click_ms;
+    /**
+     * @brief Profile a button follows.
+     * @param id Button index [0..N-1].
+     * @return Profile index, or UB::kCustomProfile after setPerConfig() (or when id is out of range).
+     */
+    [[nodiscard]] uint8_t profileOf(uint8_t id) const noexcept
+    {
+        return (id < N) ? st_.profileOf(static_cast<size_t>(id)) : UB::kCustomProfile;
+    }
 
-            // Read raw physical level: prefer fast per-pin fn, else ctx-callback, else native.
-            const bool pressed_default =
-                (read_pin_fn_) ? read_pin_fn_(pins_[i])
-                               : (read_fn_ ? read_fn_(read_ctx_, pins_[i]) : readNative_(pins_[i], per_[i].active_low));
+    /**
+     * @brief Enum-friendly overload of profileOf().
+     * @tparam E Enum type (e.g., ButtonIndex) with underlying uint8_t.
+     * @param e Enumerated button identifier.
+     * @return Profile index or UB::kCustomProfile.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] uint8_t profileOf(E e) const noexcept
+    {
+        return profileOf(static_cast<uint8_t>(e));
+    }
 
-            // Apply active level (default: active-low => pressed when LOW).
-            const bool raw = per_[i].active_low ? pressed_default : !pressed_default;
+#if UB_ADAPTIVE_DEBOUNCE
+    /**
+     * @brief Turn on debounce learning within [minTicks, maxTicks], or off with maxTicks = 0.
+     * @param minTicks Shortest window a button may learn.
+     * @param maxTicks Longest window; raw edges closer together than this belong to one bounce burst.
+     * @note Every button restarts from its configured debounce window, clamped into the bounds,
+     *       so call it again after changing debounce_ms. Keep maxTicks below the shortest real
+     *       press or gap between presses. While learning is off, debounce_ms applies unchanged.
+     *       Values are ticks of the handler's time base; millisecond handlers cap them at 65535.
+     */
+    void setAdaptiveDebounce(uint32_t minTicks, uint32_t maxTicks) noexcept
+    {
+        if (maxTicks > kLearnMax)
+            maxTicks = kLearnMax;
+        adapt_min_ = (minTicks < maxTicks) ? minTicks : maxTicks;
+        adapt_max_ = maxTicks;
+        for (size_t i = 0; i < N; ++i)
+            learned_[i] = clampLearned_(st_.debounceMs(i));
+    }
 
-            // Debounce: restart window on any raw edge.
-            if (raw != last_state_read_[i])
-            {
-                last_state_read_[i] = raw;
-                last_state_change_[i] = now;
-            }
+    /**
+     * @brief Debounce window a button currently uses (learned while learning is on).
+     * @param id Button index [0..N-1].
+     * @return Window in ticks, or 0 if id is out of range.
+     */
+    [[nodiscard]] uint32_t learnedDebounceTicks(uint8_t id) const noexcept
+    {
+        return (id < N) ? debounceMs_(id) : 0U;
+    }
 
-            // If raw has been stable long enough and differs from committed, commit it.
-            if ((now - last_state_change_[i]) >= dms && last_state_[i] != last_state_read_[i])
-            {
-                last_state_[i] = last_state_read_[i];
+    /**
+     * @brief Restore a persisted learned window (e.g. from EEPROM at boot).
+     * @param id Button index [0..N-1].
+     * @param ticks Window in ticks, clamped into the setAdaptiveDebounce() bounds.
+     * @note Ignored while learning is off or if id is out of range.
+     */
+    void setLearnedDebounceTicks(uint8_t id, uint32_t ticks) noexcept
+    {
+        if (id < N && adapt_max_ != 0u)
+            learned_[id] = clampLearned_(ticks);
+    }
 
-                if (last_state_[i])
-                {
-                    // Transition: released -> pressed (commit).
-                    press_start_[i] = now;
-                    has_press_start_[i] = true;
-                }
-                else
-                {
-                    // Transition: pressed -> released (commit).
-                    const uint32_t duration = has_press_start_[i] ? (now - press_start_[i]) : 0U;
-                    last_duration_[i] = duration; ///< Record exact duration for retrieval.
+    /**
+     * @brief Enum-friendly overload of learnedDebounceTicks().
+     * @tparam E Enum type (e.g., ButtonIndex) with underlying uint8_t.
+     * @param e Enumerated button identifier.
+     * @return Window in ticks.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] uint32_t learnedDebounceTicks(E e) const noexcept
+    {
+        return learnedDebounceTicks(static_cast<uint8_t>(e));
+    }
 
-                    if (duration >= lms)
-                    {
-                        event_[i] = ButtonPressType::Long;
+    /**
+     * @brief Enum-friendly overload of setLearnedDebounceTicks().
+     * @tparam E Enum type (e.g., ButtonIndex) with underlying uint8_t.
+     * @param e Enumerated button identifier.
+     * @param ticks Window in ticks.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    void setLearnedDebounceTicks(E e, uint32_t ticks) noexcept
+    {
+        setLearnedDebounceTicks(static_cast<uint8_t>(e), ticks);
+    }
+#endif
 
-                        // Finalized event => apply latch now (if configured).
-                        applyLatch_(i, event_[i]);
-                    }
-                    else if (duration >= sms)
-                    {
-                        // Short press: either completes a double or starts a pending single.
-                        if (pending_short_[i] && (now - pending_since_[i]) <= dcms)
-                        {
-                            event_[i] = ButtonPressType::Double;
-                            pending_short_[i] = false;
-
-                            // Finalized event => apply latch now (if configured).
-                            applyLatch_(i, event_[i]);
-                        }
-                        else
-                        {
-                            // Defer emitting Short; it will fire if no 2nd press arrives within dcms.
-                            pending_short_[i] = true;
-                            pending_since_[i] = now;
-                            // No finalized event yet => do not apply latch here.
-                        }
-                    }
-                    else
-                    {
-                        event_[i] = ButtonPressType::None;
-                    }
+    /**
+     * @brief Enum-friendly overload of enable().
+     * @tparam E Enum type (e.g., ButtonIndex) with underlying uint8_t.
+     * @param e Enumerated button identifier.
+     * @param en true to enable; false to disable.
+     * @note Inlines to the uint8_t overload; avoids casts at call sites.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    void enable(E e, bool en) noexcept
+    {
+        enable(static_cast<uint8_t>(e), en);
+    }
 
-                    press_start_[i] = 0;
-                    has_press_start_[i] = false;
-                }
-            }
+    /**
+     * @brief Enum-friendly overload of setActiveLow().
+     * @tparam E Enum type (e.g., ButtonIndex) with underlying uint8_t.
+     * @param e Enumerated button identifier.
+     * @param activeLow true => LOW is pressed; false => HIGH is pressed.
+     * @note Inlines to the uint8_t overload; avoids casts at call sites.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    void setActiveLow(E e, bool activeLow) noexcept
+    {
+        setActiveLow(static_cast<uint8_t>(e), activeLow);
+    }
 
-            // Flush pending single-click ONLY when both raw and debounced state are released.
-            // This prevents a "pending Short" from firing while a second press is already in progress
-            // but still inside the debounce window.
-            if (pending_short_[i] && event_[i] == ButtonPressType::None)
-            {
-                const uint32_t dt = now - pending_since_[i];
-                if (!last_state_[i] && !last_state_read_[i] && (dt >= dcms))
-                {
-                    event_[i] = ButtonPressType::Short;
-                    pending_short_[i] = false;
+    // ---- IButtonHandler overrides (core per-button API) ---- //
 
-                    // Finalized event => apply latch now (if configured).
-                    applyLatch_(i, event_[i]);
-                }
+    /**
+     * @brief Number of logical buttons handled by this instance.
+     * @return Compile-time constant (N) as uint8_t.
+     */
+    [[nodiscard]] uint8_t size() const noexcept override { return static_cast<uint8_t>(N); }
+
+    /**
+     * @brief Compile-time number of logical buttons.
+     * @return N as uint8_t.
+     */
+    [[nodiscard]] static constexpr uint8_t sizeStatic() noexcept { return static_cast<uint8_t>(N); }
+
+    /**
+     * @brief Iterate all debounced button states.
+     * @tparam F Callable with signature f(uint8_t index, bool pressed).
+     * @param f Callback invoked once per button.
+     */
+    template <typename F>
+    void forEach(F &&f) const noexcept
+    {
+        for (size_t i = 0; i < N; ++i)
+            f(static_cast<uint8_t>(i), UB::bits::test(last_state_, i));
+    }
+
+    /**
+     * @brief Scan and process button states using the configured time source.
+     */
+    void update() noexcept override { update(time_now()); }
+
+    /**
+     * @brief Scan and process button states using a provided timestamp.
+     * @param now Millisecond timestamp to use (e.g., from xTaskGetTickCount in RTOS).
+     */
+    void update(uint32_t now) noexcept override
+    {
+#if UB_STATS
+        const uint32_t t0 = statsNow_();
+#endif
+        // Sample every enabled button once (post-polarity, bit i = button i).
+        uint32_t raw[kWords];
+        bool edged = false; ///< Queued edges were applied (they update last_state_read_ before noteActivity_()).
+#if UB_EDGE_QUEUE_SIZE > 0
+        if (edge_mode_ && !edge_resync_)
+        {
+            // Edge mode: apply queued edges at their own timestamps; no reader calls.
+            edged = (edge_tail_ != edge_head_);
+            drainEdges_(now);
+            for (size_t w = 0; w < kWords; ++w)
+                raw[w] = edge_level_[w] & enabled_[w];
+        }
+        else
+        {
+            sample_(raw);
+            if (edge_mode_)
+            {
+                // (Re)seed levels from the readers, then trust the queue again.
+                edge_resync_ = false;
+                UB_COMPILER_BARRIER();
+                discardEdges_();
+                for (size_t w = 0; w < kWords; ++w)
+                    edge_level_[w] = raw[w];
             }
         }
+#else
+        sample_(raw);
+#endif
+        if (idle_after_ != 0U)
+            noteActivity_(raw, now, edged);
+
+#if UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_INTEGRATOR
+        debounceIntegrator_(raw, now);
+#else
+        debounceTimed_(raw, now);
+#endif
+#if UB_CHORDS > 0
+        if (chord_count_ != 0u)
+            evalChords_(now);
+#endif
+#if UB_CONCURRENT
+        publish_();
+#endif
+#if UB_STATS
+        stats_.update_ticks.add(statsNow_() - t0);
+#endif
+    }
+
+#if UB_EDGE_QUEUE_SIZE > 0
+    /**
+     * @brief Switch between polling and edge-driven input.
+     * @param on true => update() consumes edges queued by onEdgeISR() instead of calling readers.
+     * @note Enabling (and any queue overflow) makes the next update() sample the configured
+     *       reader once to seed current levels, then edge processing resumes.
+     */
+    void setEdgeMode(bool on) noexcept
+    {
+        edge_mode_ = on;
+        edge_resync_ = true;
+    }
+
+    /**
+     * @brief Whether edge-driven input is active.
+     * @return true if update() consumes queued edges.
+     */
+    [[nodiscard]] bool edgeMode() const noexcept { return edge_mode_; }
+
+    /**
+     * @brief ISR-safe entry point: queue a raw edge for a button.
+     * @param id Button index [0..N-1].
+     * @param level New reader-convention level (true = pressed, same meaning as a ReadPinFn result).
+     * @param now Timestamp (ms) of the edge, e.g. millis() read inside the ISR.
+     * @return false if the queue was full (edge dropped; levels are re-sampled on the next update()).
+     * @note Single producer: call from one ISR context (or with interrupts masked) on the
+     *       same core that runs update(). An edge stamped later than the update() that
+     *       consumes it (the ISR fired after update() read the clock) is applied at that
+     *       update()'s time.
+     */
+    bool onEdgeISR(uint8_t id, bool level, uint32_t now) noexcept
+    {
+        const uint8_t head = edge_head_;
+        const uint8_t next = static_cast<uint8_t>((head + 1u) & (UB_EDGE_QUEUE_SIZE - 1u));
+        if (next == edge_tail_)
+        {
+            if (edge_overflow_ != 0xFFFFu)
+                edge_overflow_ = static_cast<uint16_t>(edge_overflow_ + 1u);
+            edge_resync_ = true;
+            return false;
+        }
+        edges_[head].id = id;
+        edges_[head].level = level;
+        edges_[head].ts = now;
+        UB_COMPILER_BARRIER();
+        edge_head_ = next;
+        return true;
+    }
+
+    /**
+     * @brief Enum-friendly overload of onEdgeISR().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param id Enumerated button identifier.
+     * @param level New reader-convention level (true = pressed).
+     * @param now Timestamp (ms) of the edge.
+     * @return false if the queue was full.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    bool onEdgeISR(E id, bool level, uint32_t now) noexcept
+    {
+        return onEdgeISR(static_cast<uint8_t>(id), level, now);
     }
 
+    /**
+     * @brief Number of edges dropped because the queue was full (saturates at 65535).
+     */
+    [[nodiscard]] uint16_t edgeOverflowCount() const noexcept { return edge_overflow_; }
+#endif
+
     /**
      * @brief Get debounced state of a button.
      * @param buttonId Index of button.
@@ -444,7 +1003,7 @@ public:
      */
     [[nodiscard]] bool isPressed(uint8_t buttonId) const noexcept override
     {
-        return (buttonId < N) ? last_state_[buttonId] : false;
+        return (buttonId < N) ? UB::bits::test(last_state_, buttonId) : false;
     }
 
     /**
@@ -456,8 +1015,13 @@ public:
     {
         if (buttonId >= N)
             return ButtonPressType::None;
-        const ButtonPressType e = event_[buttonId];
-        event_[buttonId] = ButtonPressType::None; // consume
+        const ButtonPressType e = st_.event(buttonId);
+        st_.event(buttonId) = ButtonPressType::None; // consume
+        UB::bits::assign(event_bits_, buttonId, false);
+#if UB_STATS
+        if (e != ButtonPressType::None)
+            stats_.latency_ticks.add(statsNow_() - ev_ticks_[buttonId]);
+#endif
         return e;
     }
 
@@ -470,7 +1034,7 @@ public:
      */
     [[nodiscard]] ButtonPressType peekPressType(uint8_t buttonId) const noexcept override
     {
-        return (buttonId < N) ? event_[buttonId] : ButtonPressType::None;
+        return (buttonId < N) ? st_.event(buttonId) : ButtonPressType::None;
     }
 
     /**
@@ -481,7 +1045,7 @@ public:
      */
     [[nodiscard]] uint32_t getLastPressDuration(uint8_t buttonId) const noexcept override
     {
-        return (buttonId < N) ? last_duration_[buttonId] : 0U;
+        return (buttonId < N) ? st_.duration(buttonId) : 0U;
     }
 
     /**
@@ -491,7 +1055,7 @@ public:
      */
     [[nodiscard]] bool isLatched(uint8_t buttonId) const noexcept override
     {
-        return (buttonId < N) ? latched_.test(buttonId) : false;
+        return (buttonId < N) ? UB::bits::test(latched_, buttonId) : false;
     }
 
     /**
@@ -504,12 +1068,12 @@ public:
         if (id >= N)
             return;
 
-        const bool was = latched_.test(id);
+        const bool was = UB::bits::test(latched_, id);
         if (was == on)
             return;
 
-        latched_.set(id, on);
-        latched_changed_.set(id, true);
+        UB::bits::assign(latched_, id, on);
+        latchEdge_(id, on);
     }
 
     /**
@@ -529,13 +1093,11 @@ public:
      */
     void clearAllLatched() noexcept override
     {
-        for (size_t i = 0; i < N; ++i)
+        for (size_t w = 0; w < kWords; ++w)
         {
-            if (latched_.test(i))
-            {
-                latched_.set(i, false);
-                latched_changed_.set(i, true);
-            }
+            const uint32_t cleared = latched_[w];
+            latched_[w] = 0U;
+            latchEdges_(w, cleared, false);
         }
     }
 
@@ -543,35 +1105,90 @@ public:
      * @brief Clear a subset of latched states using a bitmask.
      * @param mask Bitmask of button indices to clear (bit0 = button 0, etc.; buttons 0..31 only).
      */
-    void clearLatchedMask(uint32_t mask) noexcept override
+    void clearLatchedMask(uint32_t mask) noexcept override { clearLatchedWords(&mask, 1); }
+
+    /**
+     * @brief Clear a subset of latched states using a packed word mask.
+     * @param mask Word array (bit i of mask[i / 32] = button i).
+     * @param nwords Number of words in @p mask; buttons beyond it are untouched.
+     */
+    void clearLatchedWords(const uint32_t *mask, size_t nwords) noexcept override
     {
-        for (size_t i = 0; i < N && i < 32; ++i)
+        const size_t n = (nwords < kWords) ? nwords : kWords;
+        for (size_t w = 0; w < n; ++w)
         {
-            if ((mask & (1u << i)) != 0u && latched_.test(i))
-            {
-                latched_.set(i, false);
-                latched_changed_.set(i, true);
-            }
+            const uint32_t cleared = latched_[w] & mask[w];
+            latched_[w] &= ~cleared;
+            latchEdges_(w, cleared, false);
         }
     }
 
     /**
-     * @brief Build a 32-bit latched mask.
-     * @return Bitmask where bit i is set when button i is latched ON (up to 32 buttons).
-     * @note ButtonHandler<N> supports up to 255 buttons, but this helper only reports buttons 0..31.
+     * @brief Force the latched state of a subset of buttons using a bitmask.
+     * @param mask Bitmask of button indices to change (buttons 0..31 only).
+     * @param on Desired latched state.
      */
-    [[nodiscard]] uint32_t latchedMask() const noexcept override
+    void setLatchedMask(uint32_t mask, bool on) noexcept override { setLatchedWords(&mask, 1, on); }
+
+    /**
+     * @brief Force the latched state of a subset of buttons using a packed word mask.
+     * @param mask Word array (bit i of mask[i / 32] = button i).
+     * @param nwords Number of words in @p mask; buttons beyond it are untouched.
+     * @param on Desired latched state.
+     * @note One pass over the words; only buttons whose state changes report a latch edge.
+     */
+    void setLatchedWords(const uint32_t *mask, size_t nwords, bool on) noexcept override
     {
-        uint32_t m = 0U;
-        const uint8_t n = static_cast<uint8_t>((N < 32) ? N : 32);
-        for (uint8_t i = 0; i < n; ++i)
+        const size_t n = (nwords < kWords) ? nwords : kWords;
+        for (size_t w = 0; w < n; ++w)
         {
-            if (latched_.test(i))
-                m |= (1u << i);
+            const uint32_t m = mask[w] & validMask_(w);
+            const uint32_t changed = (on ? ~latched_[w] : latched_[w]) & m;
+            latched_[w] ^= changed;
+            latchEdges_(w, changed, on);
         }
-        return m;
     }
 
+    /**
+     * @brief Build a 32-bit pressed mask (bit i == 1 iff button i is pressed).
+     * @note Only buttons 0..31 are represented. Use pressedWords() for wider handlers.
+     */
+    [[nodiscard]] uint32_t pressedMask() const noexcept override { return last_state_[0]; }
+
+    /**
+     * @brief Build a 32-bit latched mask.
+     * @return Bitmask where bit i is set when button i is latched ON (up to 32 buttons).
+     * @note ButtonHandler<N> supports up to 255 buttons, but this helper only reports buttons 0..31.
+     *       Use latchedWords() for wider handlers.
+     */
+    [[nodiscard]] uint32_t latchedMask() const noexcept override { return latched_[0]; }
+
+    /**
+     * @brief Build a 32-bit mask of buttons with an unread event (buttons 0..31).
+     */
+    [[nodiscard]] uint32_t eventMask() const noexcept override { return event_bits_[0]; }
+
+    /**
+     * @brief Copy the debounced pressed state as packed words.
+     * @param out Destination (bit i of out[i / 32] = button i pressed).
+     * @param nwords Words available in @p out; words beyond kWords are zeroed.
+     */
+    void pressedWords(uint32_t *out, size_t nwords) const noexcept override { copyWords_(last_state_, out, nwords); }
+
+    /**
+     * @brief Copy the latched state as packed words.
+     * @param out Destination (bit i of out[i / 32] = button i latched ON).
+     * @param nwords Words available in @p out; words beyond kWords are zeroed.
+     */
+    void latchedWords(uint32_t *out, size_t nwords) const noexcept override { copyWords_(latched_, out, nwords); }
+
+    /**
+     * @brief Copy the "unread event" flags as packed words.
+     * @param out Destination (bit i of out[i / 32] = getPressType(i) would return an event).
+     * @param nwords Words available in @p out; words beyond kWords are zeroed.
+     */
+    void eventWords(uint32_t *out, size_t nwords) const noexcept override { copyWords_(event_bits_, out, nwords); }
+
     /**
      * @brief Edge flag for latching: true if latched state changed since the last clear.
      * @param buttonId Index of button.
@@ -581,94 +1198,488 @@ public:
     {
         if (buttonId >= N)
             return false;
-        const bool v = latched_changed_.test(buttonId);
-        latched_changed_.set(buttonId, false);
+        const bool v = UB::bits::test(latched_changed_, buttonId);
+        UB::bits::assign(latched_changed_, buttonId, false);
         return v;
     }
 
+#if UB_EVENT_QUEUE_SIZE > 0
     /**
-     * @brief Clear all pending events and re-initialize debounced state.
+     * @brief Move queued events (oldest first) into @p out.
+     * @param out Destination array.
+     * @param max Capacity of @p out.
+     * @return Number of events written (0 when the queue is empty).
+     * @note Independent of getPressType(): draining does not clear the per-button slot.
      */
-    void reset() noexcept override
+    size_t drainEvents(ButtonEvent *out, size_t max) noexcept
     {
-        const uint32_t t0 = time_now();
-        for (size_t i = 0; i < N; ++i)
+        size_t n = 0;
+        const uint8_t head = ev_head_;
+        uint8_t tail = ev_tail_;
+        UB_SHARED_FENCE(); ///< Slots up to head are complete.
+        while (n < max && tail != head)
         {
-            last_state_[i] = false;      ///< Committed (debounced).
-            last_state_read_[i] = false; ///< Last raw (post-polarity) state.
-            last_state_change_[i] = t0;  ///< Restart debounce window.
-            press_start_[i] = 0;
-            has_press_start_[i] = false;
-            event_[i] = ButtonPressType::None;
-            last_duration_[i] = 0;
-            pending_short_[i] = false;
-            pending_since_[i] = 0;
-            latched_.set(i, per_[i].latch_initial);
-            latched_changed_.set(i, false);
+            out[n++] = events_[tail];
+            tail = static_cast<uint8_t>((tail + 1u) & (UB_EVENT_QUEUE_SIZE - 1u));
         }
+        UB_SHARED_FENCE(); ///< Finish reading before handing slots back.
+        ev_tail_ = tail;
+        return n;
     }
 
-    // ---- Enum-friendly overloads (no cast needed in sketches) ---- //
-
     /**
-     * @brief Enum-friendly overload of isPressed().
-     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
-     * @param buttonId Enumerated button identifier.
-     * @return true if the debounced state is pressed; false otherwise.
+     * @brief Number of events waiting in the queue.
      */
-    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
-    [[nodiscard]] bool isPressed(E buttonId) const noexcept
+    [[nodiscard]] size_t eventsPending() const noexcept
     {
-        return isPressed(static_cast<uint8_t>(buttonId));
+        return static_cast<size_t>((ev_head_ - ev_tail_) & (UB_EVENT_QUEUE_SIZE - 1u));
     }
 
     /**
-     * @brief Enum-friendly overload of getPressType().
-     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
-     * @param buttonId Enumerated button identifier.
-     * @return ButtonPressType event: Short, Long, or None.
+     * @brief Number of events dropped because the queue was full (saturates at 65535).
      */
-    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
-    ButtonPressType getPressType(E buttonId) noexcept
-    {
-        return getPressType(static_cast<uint8_t>(buttonId));
-    }
+    [[nodiscard]] uint16_t eventOverflowCount() const noexcept { return ev_overflow_; }
+#endif
 
+#if UB_CHORDS > 0
     /**
-     * @brief Enum-friendly overload of peekPressType().
-     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
-     * @param buttonId Enumerated button identifier.
-     * @return Pending ButtonPressType event without consuming it.
+     * @brief Register a button combination.
+     * @param mask Member buttons as packed words (bit i of mask[i / 32] = button i).
+     * @param nwords Number of words in @p mask; buttons beyond it are not members.
+     * @param holdMs How long every member must be held together before the chord fires (0 = at once).
+     * @return Chord id, or 0xFF if the table is full or @p mask names no button.
+     * @note Once a chord fires, its members' releases produce no Short/Long/Double and their
+     *       hold events stop until they are pressed again.
      */
-    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
-    [[nodiscard]] ButtonPressType peekPressType(E buttonId) const noexcept
+    uint8_t addChordWords(const uint32_t *mask, size_t nwords, uint32_t holdMs = 0) noexcept
     {
-        return peekPressType(static_cast<uint8_t>(buttonId));
+        if (chord_count_ >= UB_CHORDS)
+            return 0xFF;
+        uint32_t any = 0U;
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            chord_mask_[chord_count_][w] = (w < nwords) ? (mask[w] & validMask_(w)) : 0U;
+            any |= chord_mask_[chord_count_][w];
+        }
+        if (any == 0U)
+            return 0xFF;
+        chord_hold_[chord_count_] = holdMs;
+        return chord_count_++;
     }
 
     /**
-     * @brief Enum-friendly wrapper for querying the exact duration (ms) of the last completed press.
-     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
-     * @param buttonId Enumerated button identifier.
-     * @return Milliseconds of the most recent *completed* press for buttonId.
-     *         Returns 0 if no press has been recorded yet or if buttonId is out of range.
+     * @brief Register a combination of buttons 0..31.
+     * @param mask Member bitmask (bit i = button i).
+     * @param holdMs Hold time before the chord fires (0 = at once).
+     * @return Chord id, or 0xFF.
      */
-    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
-    [[nodiscard]] uint32_t getLastPressDuration(E buttonId) const noexcept
+    uint8_t addChordMask(uint32_t mask, uint32_t holdMs = 0) noexcept { return addChordWords(&mask, 1, holdMs); }
+
+    /**
+     * @brief Register a combination from a list of button indices (or enum values).
+     * @tparam T uint8_t or an enum type.
+     * @tparam K Number of members.
+     * @param ids Member buttons.
+     * @param holdMs Hold time before the chord fires (0 = at once).
+     * @return Chord id, or 0xFF.
+     */
+    template <typename T, size_t K>
+    uint8_t addChord(const T (&ids)[K], uint32_t holdMs = 0) noexcept
     {
-        return getLastPressDuration(static_cast<uint8_t>(buttonId));
+        uint32_t mask[kWords] = {};
+        for (size_t k = 0; k < K; ++k)
+        {
+            const uint8_t id = static_cast<uint8_t>(ids[k]);
+            if (id < N)
+                UB::bits::assign(mask, id, true);
+        }
+        return addChordWords(mask, kWords, holdMs);
     }
 
     /**
-     * @brief Enum-friendly overload of isLatched().
-     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
-     * @param buttonId Enumerated button identifier.
-     * @return true if latched ON; false otherwise.
+     * @brief Remove every chord.
      */
-    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
-    [[nodiscard]] bool isLatched(E buttonId) const noexcept
+    void clearChords() noexcept
     {
-        return isLatched(static_cast<uint8_t>(buttonId));
+        chord_count_ = 0;
+        chord_on_ = 0U;
+        chord_fired_ = 0U;
+        chord_events_ = 0U;
+        for (size_t w = 0; w < kWords; ++w)
+            chord_used_[w] = 0U;
+    }
+
+    /**
+     * @brief Whether a chord fired since the last call (consumes the flag).
+     * @param c Chord id from addChord().
+     * @return true once per firing.
+     */
+    bool chordFired(uint8_t c) noexcept
+    {
+        if (c >= chord_count_)
+            return false;
+        const uint32_t bit = static_cast<uint32_t>(1u) << c;
+        const bool v = (chord_events_ & bit) != 0U;
+        chord_events_ &= ~bit;
+        return v;
+    }
+
+    /**
+     * @brief Enum-friendly overload of chordFired().
+     * @tparam E Enum type naming the chords.
+     * @param c Enumerated chord id.
+     * @return true once per firing.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    bool chordFired(E c) noexcept
+    {
+        return chordFired(static_cast<uint8_t>(c));
+    }
+
+    /**
+     * @brief Whether every member of a chord is pressed right now (debounced).
+     * @param c Chord id from addChord().
+     */
+    [[nodiscard]] bool isChordHeld(uint8_t c) const noexcept
+    {
+        return (c < chord_count_) && (chord_on_ & (static_cast<uint32_t>(1u) << c)) != 0U;
+    }
+
+    /**
+     * @brief Mask of chords that fired and have not been read with chordFired() (bit c = chord c).
+     */
+    [[nodiscard]] uint32_t chordMask() const noexcept { return chord_events_; }
+#endif
+
+#if UB_CONCURRENT
+    /**
+     * @brief Copy the last published pressed/latched words (safe from any core, never blocks the scanner).
+     * @param pressed Destination for pressed words (may be nullptr).
+     * @param latched Destination for latched words (may be nullptr).
+     * @param nwords Words available in each destination; extra words are written as 0.
+     * @return Number of publications so far (increments once per update()/reset()).
+     * @note Both arrays come from the same update(). The scanner writes the buffer readers
+     *       are not using, so a reader only retries if two publications complete mid-copy.
+     */
+    uint32_t readShared(uint32_t *pressed, uint32_t *latched, size_t nwords) const noexcept
+    {
+        for (;;)
+        {
+            const uint8_t b = pub_cur_;
+            UB_SHARED_FENCE();
+            const uint32_t v = pub_[b].version;
+            if ((v & 1u) != 0u)
+                continue; ///< Buffer was recycled after b was read; pick the current one.
+            UB_SHARED_FENCE();
+            const uint32_t count = pub_[b].count;
+            for (size_t w = 0; w < nwords; ++w)
+            {
+                if (pressed)
+                    pressed[w] = (w < kWords) ? pub_[b].pressed[w] : 0U;
+                if (latched)
+                    latched[w] = (w < kWords) ? pub_[b].latched[w] : 0U;
+            }
+            UB_SHARED_FENCE();
+            if (pub_[b].version == v)
+                return count;
+        }
+    }
+
+    /**
+     * @brief Published debounced state of one button (safe from any core).
+     * @param buttonId Button index.
+     * @return true if pressed in the last published update(); false if out of range.
+     */
+    [[nodiscard]] bool isPressedShared(uint8_t buttonId) const noexcept
+    {
+        if (buttonId >= N)
+            return false;
+        uint32_t w[kWords];
+        readShared(w, nullptr, kWords);
+        return UB::bits::test(w, buttonId);
+    }
+
+    /**
+     * @brief Enum-friendly overload of isPressedShared().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return true if pressed in the last published update().
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] bool isPressedShared(E buttonId) const noexcept
+    {
+        return isPressedShared(static_cast<uint8_t>(buttonId));
+    }
+
+    /**
+     * @brief Published latched state of one button (safe from any core).
+     * @param buttonId Button index.
+     * @return true if latched in the last published update(); false if out of range.
+     */
+    [[nodiscard]] bool isLatchedShared(uint8_t buttonId) const noexcept
+    {
+        if (buttonId >= N)
+            return false;
+        uint32_t w[kWords];
+        readShared(nullptr, w, kWords);
+        return UB::bits::test(w, buttonId);
+    }
+
+    /**
+     * @brief Enum-friendly overload of isLatchedShared().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return true if latched in the last published update().
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] bool isLatchedShared(E buttonId) const noexcept
+    {
+        return isLatchedShared(static_cast<uint8_t>(buttonId));
+    }
+#endif
+
+    /**
+     * @brief Earliest time (ms) at which update() has timing work to do.
+     * @param now Current time (ms).
+     * @return Absolute timestamp (now if already due), or UB::kNoDeadline when idle.
+     * @note Covers open debounce windows (and eager lockouts), pending double-click windows,
+     *       the next Repeat of a held repeating button, the Long threshold of a held
+     *       long_on_hold button, held chords waiting for their hold time, and queued edges or a
+     *       pending edge re-seed (@p now). A held button without Repeat or long_on_hold adds no
+     *       deadline: its Long is classified on release. Call it after consuming events: a
+     *       deferred Short waits for the previous event to be read. With UB_DEBOUNCE_INTEGRATOR,
+     *       an unsettled sample history returns @p now because the integrator advances per scan
+     *       rather than per millisecond.
+     */
+    [[nodiscard]] uint32_t nextDeadline(uint32_t now) const noexcept override
+    {
+#if UB_EDGE_QUEUE_SIZE > 0
+        // A pending re-seed or queued edges need an update() right away.
+        if (edge_mode_ && (edge_resync_ || edge_head_ != edge_tail_))
+            return now;
+#endif
+        uint32_t wait = UB::kNoDeadline;
+        for (size_t w = 0; w < kWords; ++w)
+        {
+#if UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_INTEGRATOR
+            uint32_t all = ~static_cast<uint32_t>(0U);
+            uint32_t any = 0U;
+            for (size_t s = 0; s < UB_DEBOUNCE_SAMPLES; ++s)
+            {
+                all &= hist_[s][w];
+                any |= hist_[s][w];
+            }
+            if (((all ^ any) & enabled_[w]) != 0U)
+                return now;
+            uint32_t m = pending_short_[w] | (last_state_[w] & (repeat_mask_[w] | long_hold_mask_[w]));
+#else
+            uint32_t m = ((last_state_read_[w] ^ last_state_[w]) & enabled_[w]) | pending_short_[w] |
+                         (last_state_[w] & (repeat_mask_[w] | long_hold_mask_[w]));
+#endif
+            while (m)
+            {
+                const size_t i = (w << 5) + UB::bits::lowestSet(m);
+                m &= m - 1u;
+
+#if UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_INTEGRATOR
+                // Settled history: a pending Short only waits for its window to close.
+                if (!UB::bits::test(last_state_, i))
+                {
+                    if (!shortQueued_(i))
+                        foldDeadline_(wait, now, st_.pendingSince(i, now) + doubleMs_(i));
+                }
+                else
+                {
+                    uint32_t due = 0U;
+                    if (holdDue_(i, now, due))
+                        foldDeadline_(wait, now, due);
+                }
+#else
+                uint32_t due = 0U;
+                if (timerDue_(i, now, due))
+                    foldDeadline_(wait, now, due);
+#endif
+            }
+        }
+#if UB_CHORDS > 0
+        // Held chords waiting for their hold time.
+        uint32_t pending = chord_on_ & ~chord_fired_;
+        while (pending)
+        {
+            const uint8_t c = UB::bits::lowestSet(pending);
+            pending &= pending - 1u;
+            foldDeadline_(wait, now, chord_since_[c] + chord_hold_[c]);
+        }
+#endif
+        return deadlineAt_(now, wait);
+    }
+
+    /**
+     * @brief Slow the recommended scan rate while nothing is happening.
+     * @param idleAfterTicks Quiet time (no raw edge, nothing pressed or pending) before scanning slows; 0 = off.
+     * @param idleIntervalTicks Scan period recommended while idle (e.g. 50 => 20 Hz on UB::time::Millis).
+     * @param activeIntervalTicks Scan period recommended otherwise (default 1 ms, Time::kTicksPerMs ticks).
+     * @note Only changes what recommendedScanIntervalTicks() reports; update() behaves the same at
+     *       any call rate. A press that starts while idle is seen up to idleIntervalTicks late, and its
+     *       duration is measured from that scan. All values are ticks of the handler's time base.
+     */
+    void setIdleScan(uint32_t idleAfterTicks, uint32_t idleIntervalTicks,
+                     uint32_t activeIntervalTicks = Time::kTicksPerMs) noexcept
+    {
+        idle_after_ = idleAfterTicks;
+        idle_interval_ = idleIntervalTicks;
+        active_interval_ = activeIntervalTicks;
+    }
+
+    /**
+     * @brief How long the caller may wait before the next update(), in ticks.
+     * @param now Current time (ticks).
+     * @return The active interval while any button is pressed, a debounce/double-click/hold
+     *         window is open, or a raw edge was seen less than idleAfterTicks ago; else the idle
+     *         interval (see setIdleScan()).
+     * @note Idle is only reported when nextDeadline() has nothing pending, so the longer wait never delays timing work.
+     */
+    [[nodiscard]] uint32_t recommendedScanIntervalTicks(uint32_t now) const noexcept
+    {
+        if (idle_after_ == 0U || (now - activity_at_) < idle_after_)
+            return active_interval_;
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            if (last_state_[w] != 0U)
+                return active_interval_;
+        }
+        return (nextDeadline(now) == UB::kNoDeadline) ? idle_interval_ : active_interval_;
+    }
+
+    /**
+     * @brief recommendedScanIntervalTicks() at the configured time source's current time.
+     */
+    [[nodiscard]] uint32_t recommendedScanIntervalTicks() const noexcept { return recommendedScanIntervalTicks(time_now()); }
+
+    /**
+     * @brief update() with the configured time source, then the recommended wait before the next one.
+     * @return Time-base ticks to sleep, e.g. vTaskDelay(pdMS_TO_TICKS(btns.updateAndSchedule())) for a
+     *         UB::time::Millis handler in a scan task.
+     */
+    uint32_t updateAndSchedule() noexcept
+    {
+        const uint32_t now = time_now();
+        update(now);
+        return recommendedScanIntervalTicks(now);
+    }
+
+    /**
+     * @brief Clear all pending events and re-initialize debounced state.
+     * @note With UB_CONCURRENT, call on the scanner core while the consumer is not draining.
+     */
+    void reset() noexcept override
+    {
+        const uint32_t t0 = time_now();
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            last_state_[w] = 0U;      ///< Committed (debounced).
+            last_state_read_[w] = 0U; ///< Last raw (post-polarity) state.
+            pending_short_[w] = 0U;   ///< No pending single-clicks.
+#if UB_EVENT_QUEUE_SIZE > 0
+            short_queued_[w] = 0U; ///< No held-back Short in the FIFO.
+#endif
+            event_bits_[w] = 0U;      ///< No unread events.
+            latched_changed_[w] = 0U; ///< No latch edges.
+            long_fired_[w] = 0U;      ///< No hold Long fired.
+#if UB_CHORDS > 0
+            chord_used_[w] = 0U;      ///< No chord members.
+#endif
+        }
+#if UB_CHORDS > 0
+        chord_on_ = 0U;
+        chord_fired_ = 0U;
+        chord_events_ = 0U;
+#endif
+#if UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_INTEGRATOR
+        clearHistory_();
+#endif
+#if UB_EVENT_QUEUE_SIZE > 0
+        ev_head_ = 0; ///< Drop queued events.
+        ev_tail_ = 0;
+#endif
+        for (size_t i = 0; i < N; ++i)
+        {
+            st_.setLastChange(i, t0); ///< Restart debounce window.
+            st_.setPressStart(i, 0);
+            st_.setHasPress(i, false);
+            st_.event(i) = ButtonPressType::None;
+            st_.setDuration(i, 0);
+            st_.setPendingSince(i, 0);
+            repeat_count_[i] = 0;
+            agree_[i] = 0;
+            UB::bits::assign(latched_, i, st_.behavior(i).latch_initial);
+        }
+#if UB_CONCURRENT
+        publish_();
+#endif
+    }
+
+    // ---- Enum-friendly overloads (no cast needed in sketches) ---- //
+
+    /**
+     * @brief Enum-friendly overload of isPressed().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return true if the debounced state is pressed; false otherwise.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] bool isPressed(E buttonId) const noexcept
+    {
+        return isPressed(static_cast<uint8_t>(buttonId));
+    }
+
+    /**
+     * @brief Enum-friendly overload of getPressType().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return ButtonPressType event: Short, Long, or None.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    ButtonPressType getPressType(E buttonId) noexcept
+    {
+        return getPressType(static_cast<uint8_t>(buttonId));
+    }
+
+    /**
+     * @brief Enum-friendly overload of peekPressType().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return Pending ButtonPressType event without consuming it.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] ButtonPressType peekPressType(E buttonId) const noexcept
+    {
+        return peekPressType(static_cast<uint8_t>(buttonId));
+    }
+
+    /**
+     * @brief Enum-friendly wrapper for querying the exact duration (ms) of the last completed press.
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return Milliseconds of the most recent *completed* press for buttonId.
+     *         Returns 0 if no press has been recorded yet or if buttonId is out of range.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] uint32_t getLastPressDuration(E buttonId) const noexcept
+    {
+        return getLastPressDuration(static_cast<uint8_t>(buttonId));
+    }
+
+    /**
+     * @brief Enum-friendly overload of isLatched().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return true if latched ON; false otherwise.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] bool isLatched(E buttonId) const noexcept
+    {
+        return isLatched(static_cast<uint8_t>(buttonId));
     }
 
     /**
@@ -677,90 +1688,1266 @@ public:
      * @param buttonId Enumerated button identifier.
      * @return true if the latched state changed since the previous call (and clears the flag).
      */
-    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
-    bool getAndClearLatchedChanged(E buttonId) noexcept
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    bool getAndClearLatchedChanged(E buttonId) noexcept
+    {
+        return getAndClearLatchedChanged(static_cast<uint8_t>(buttonId));
+    }
+
+private:
+    // ---- Storage ---- //
+
+    uint8_t pins_[N]{};                       ///< Pin or logical IDs.
+    uint32_t last_state_[kWords]{};           ///< Last committed (debounced) state, packed (bit i = button i).
+    uint32_t last_state_read_[kWords]{};      ///< Most recent raw state (after polarity), packed.
+    uint32_t enabled_[kWords]{};              ///< Enabled flags, packed (authoritative; ButtonPerConfig::enabled is only an input).
+    uint32_t invert_[kWords]{};               ///< Active-high flags, packed (raw XOR mask; authoritative for active_low).
+    uint32_t pending_short_[kWords]{};        ///< Pending single waiting for possible double, packed.
+    uint32_t pending_duration_[N]{};          ///< Duration of the press behind a pending Short.
+    UB::layout::ButtonState<N, Layout, Time::kTicksPerMs> st_; ///< Per-button timestamps, event slots, overrides and resolved timing.
+    ButtonTimingConfig timing_;               ///< Global debounce and press-duration configuration.
+    uint32_t event_bits_[kWords]{};           ///< Packed mirror of st_.event(i) != None.
+    uint32_t latched_[kWords]{};              ///< Latched state, packed.
+    uint32_t latched_changed_[kWords]{};      ///< Edge flag: latched state changed since last clear, packed.
+    uint32_t repeat_mask_[kWords]{};          ///< Buttons with a non-zero resolved repeat delay, packed.
+    uint8_t repeat_count_[N]{};               ///< Repeats fired during the current hold (saturates at 255).
+    uint32_t long_hold_mask_[kWords]{};       ///< Buttons with ButtonPerConfig::long_on_hold, packed.
+    uint32_t long_fired_[kWords]{};           ///< Long already emitted during the current hold, packed.
+    uint32_t early_mask_[kWords]{};           ///< Buttons with ButtonPerConfig::early_short, packed.
+    uint32_t eager_mask_[kWords]{};           ///< Buttons with ButtonPerConfig::eager_samples != 0, packed.
+    uint8_t agree_[N]{};                      ///< Consecutive scans an eager button's raw level has differed from its committed one.
+#if UB_EDGE_QUEUE_SIZE > 0
+    /**
+     * @brief One queued raw edge (written by onEdgeISR(), read by update()).
+     */
+    struct Edge
+    {
+        uint8_t id;    ///< Button index.
+        bool level;    ///< Reader-convention level (true = pressed).
+        uint32_t ts;   ///< Edge timestamp (ms).
+    };
+
+    Edge edges_[UB_EDGE_QUEUE_SIZE]{};   ///< SPSC ring (producer: ISR, consumer: update()); slots ordered by UB_COMPILER_BARRIER().
+    volatile uint8_t edge_head_{0};      ///< Next slot the ISR writes.
+    volatile uint8_t edge_tail_{0};      ///< Next slot update() reads.
+    volatile uint16_t edge_overflow_{0}; ///< Dropped-edge counter.
+    volatile bool edge_resync_{true};    ///< Re-sample readers on the next update().
+    bool edge_mode_{false};              ///< update() consumes queued edges.
+    uint32_t edge_level_[kWords]{};      ///< Latest raw level per button (after polarity), packed.
+#endif
+#if UB_EVENT_QUEUE_SIZE > 0
+    ButtonEvent events_[UB_EVENT_QUEUE_SIZE]{}; ///< Finalized-event FIFO (producer: update(), consumer: drainEvents()).
+#if UB_CONCURRENT
+    volatile uint8_t ev_head_{0};               ///< Next slot deliver_() writes (scanner core).
+    volatile uint8_t ev_tail_{0};               ///< Next slot drainEvents() reads (consumer core).
+#else
+    uint8_t ev_head_{0};                        ///< Next slot deliver_() writes.
+    uint8_t ev_tail_{0};                        ///< Next slot drainEvents() reads.
+#endif
+    uint16_t ev_overflow_{0};                   ///< Dropped-event counter.
+    uint32_t short_queued_[kWords]{};           ///< Held-back pending Short already pushed to the FIFO, packed.
+#endif
+#if UB_CONCURRENT
+    /**
+     * @brief One published snapshot; version is odd while the scanner rewrites it.
+     */
+    struct Published
+    {
+        uint32_t version;          ///< Per-buffer sequence (odd = being written).
+        uint32_t count;            ///< Publication number.
+        uint32_t pressed[kWords];  ///< Debounced state.
+        uint32_t latched[kWords];  ///< Latched state.
+    };
+
+    Published pub_[2]{};            ///< Double buffer (scanner writes the one readers are not pointed at).
+    volatile uint8_t pub_cur_{0};   ///< Buffer readers should use.
+    uint32_t pub_count_{0};         ///< Publications so far.
+#endif
+#if UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_INTEGRATOR
+    uint32_t hist_[UB_DEBOUNCE_SAMPLES][kWords]{}; ///< Raw sample history (integrator engine).
+    uint8_t hist_pos_{0};                          ///< Next history slot to overwrite.
+    uint8_t quiet_scans_{0};                       ///< Consecutive all-released samples (history is clear at UB_DEBOUNCE_SAMPLES).
+#endif
+#if UB_CHORDS > 0
+    uint32_t chord_mask_[UB_CHORDS][kWords]{}; ///< Member buttons per chord, packed.
+    uint32_t chord_hold_[UB_CHORDS]{};         ///< Hold time per chord (ms).
+    uint32_t chord_since_[UB_CHORDS]{};        ///< Time every member was first seen pressed together.
+    uint32_t chord_on_{0};                     ///< Chords whose members are all pressed (bit c = chord c).
+    uint32_t chord_fired_{0};                  ///< Chords that fired during the current hold.
+    uint32_t chord_events_{0};                 ///< Fired chords not yet read by chordFired().
+    uint32_t chord_used_[kWords]{};            ///< Buttons whose current press belongs to a fired chord, packed.
+    uint8_t chord_count_{0};                   ///< Registered chords.
+#endif
+#if UB_ADAPTIVE_DEBOUNCE
+    Learn learned_[N]{};             ///< Learned debounce window (ticks) per button.
+    Learn burst_start_[N]{};         ///< Low bits of the time the current bounce burst began.
+    uint32_t adapt_min_{0};          ///< Lower learning bound (ticks).
+    uint32_t adapt_max_{0};          ///< Upper learning bound and burst gap (ticks); 0 = learning off.
+#endif
+#if UB_STATS
+    Stats stats_{};                  ///< Diagnostic counters.
+    uint32_t ev_ticks_[N]{};         ///< Stats-clock tick at which the event in each slot was finalized.
+    CycleFn stats_clock_{nullptr};   ///< Optional stats tick source.
+#endif
+
+    // ---- Readers ---- //
+
+    ReadPinFn read_pin_fn_{nullptr};   ///< Optional fast-path reader (per-pin).
+    ReadFn read_fn_{nullptr};          ///< Optional context-aware reader.
+    void *read_ctx_{nullptr};          ///< Opaque context for @c read_fn_.
+    ReadBankFn read_bank_fn_{nullptr}; ///< Optional bulk reader (one call per update).
+    void *bank_ctx_{nullptr};          ///< Opaque context for @c read_bank_fn_.
+
+    // ---- Dispatch ---- //
+
+    EventFn event_fn_{nullptr}; ///< Optional event callback (replaces the per-button slots).
+    void *event_ctx_{nullptr};  ///< Opaque context for @c event_fn_.
+    LatchFn latch_fn_{nullptr}; ///< Optional latch-edge callback (replaces latched_changed_).
+    void *latch_ctx_{nullptr};  ///< Opaque context for @c latch_fn_.
+
+    // ---- Time source ---- //
+
+    TimeFn time_fn_{nullptr};
+
+    // ---- Idle scan decimation ---- //
+
+    uint32_t idle_after_{0};                          ///< Quiet time before the idle interval applies (0 = off).
+    uint32_t idle_interval_{0};                       ///< Recommended scan period while idle.
+    uint32_t active_interval_{Time::kTicksPerMs};     ///< Recommended scan period otherwise.
+    uint32_t activity_at_{0};                         ///< Time of the latest raw edge.
+
+    /**
+     * @brief Shared constructor body: copy pins, configure GPIO, and initialize all per-button state.
+     * @param buttonPins Reference to an array of length N with pin IDs.
+     * @param skipPinInit If true, GPIO mode is not configured.
+     */
+    void init_(const uint8_t (&buttonPins)[N], bool skipPinInit) noexcept
+    {
+        const uint32_t t0 = time_now();
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            last_state_[w] = 0U;
+            last_state_read_[w] = 0U;
+            pending_short_[w] = 0U;
+#if UB_EVENT_QUEUE_SIZE > 0
+            short_queued_[w] = 0U;
+#endif
+            enabled_[w] = 0U;
+            invert_[w] = 0U;
+        }
+        st_.resolveAll(timing_);
+        for (size_t i = 0; i < N; ++i)
+        {
+            pins_[i] = buttonPins[i];
+            if (!skipPinInit)
+                initPin_(pins_[i]);
+            UB::bits::assign(enabled_, i, true);
+            st_.setLastChange(i, t0);
+            st_.setPressStart(i, 0);
+            st_.setHasPress(i, false);
+            st_.event(i) = ButtonPressType::None;
+            st_.setProfile(i, 0, timing_);
+            st_.setDuration(i, 0);
+            st_.setPendingSince(i, 0);
+            repeat_count_[i] = 0;
+            agree_[i] = 0;
+            UB::bits::assign(latched_, i, st_.behavior(i).latch_initial);
+        }
+        refreshFlagsAll_();
+    }
+
+    /**
+     * @brief Configure a native Arduino GPIO pin when Arduino support is available.
+     * @param pin MCU GPIO pin number.
+     * @note Outside Arduino builds this is intentionally a no-op; use skipPinInit=true
+     *       and configure inputs in the platform adapter/application.
+     */
+    static inline void initPin_(uint8_t pin) noexcept
+    {
+#if UB_HAS_ARDUINO
+        pinMode(pin, INPUT_PULLUP);
+#else
+        (void)pin;
+#endif
+    }
+
+    /**
+     * @brief Read a native Arduino GPIO button using the library default polarity.
+     * @param pin MCU GPIO pin number.
+     * @param activeLow Current button polarity.
+     * @return true when the pin reads LOW on Arduino; inactive fallback when no native GPIO API exists.
+     * @note Non-Arduino builds should provide ReadPinFn/ReadFn readers instead of relying
+     *       on the native GPIO fallback.
+     */
+    static inline bool readNative_(uint8_t pin, bool activeLow) noexcept
+    {
+#if UB_HAS_ARDUINO
+        (void)activeLow;
+        return digitalRead(pin) == LOW;
+#else
+        (void)pin;
+        // Return the value that becomes "not pressed" after the active_low transform below.
+        return activeLow ? false : true;
+#endif
+    }
+
+    /**
+     * @brief Resolve the current time in ticks. Uses injected TimeFn when provided, otherwise Time::now().
+     * @note Outside Arduino builds, pass TimeFn or call update(now); otherwise this returns 0.
+     */
+    inline uint32_t time_now() const noexcept
+    {
+        if (time_fn_)
+            return time_fn_();
+        return Time::now();
+    }
+
+    /**
+     * @brief Record the time of any raw edge since the previous update() (idle decimation).
+     * @param raw Raw levels of this update(), packed.
+     * @param now Current time (ms).
+     * @param edged Queued edges were already applied this update().
+     * @note Runs before the debouncer, so last_state_read_ still holds the previous update()'s raw levels.
+     */
+    inline void noteActivity_(const uint32_t *raw, uint32_t now, bool edged) noexcept
+    {
+        uint32_t diff = edged ? 1U : 0U;
+        for (size_t w = 0; w < kWords; ++w)
+            diff |= raw[w] ^ last_state_read_[w];
+        if (diff != 0U)
+            activity_at_ = now;
+    }
+
+#if UB_STATS
+    /**
+     * @brief Read the stats tick counter (CycleFn, else Arduino micros()).
+     */
+    inline uint32_t statsNow_() const noexcept
+    {
+        if (stats_clock_)
+            return stats_clock_();
+#if UB_HAS_ARDUINO
+        return micros();
+#else
+        return 0U;
+#endif
+    }
+
+    /**
+     * @brief Count one raw edge inside an open debounce window.
+     * @param i Button index.
+     */
+    inline void countBounce_(size_t i) noexcept
+    {
+        if (stats_.bounces[i] != 0xFFFFu)
+            ++stats_.bounces[i];
+    }
+
+    /**
+     * @brief Histogram bucket for a completed press (bucket bounds are in ms, scaled to ticks).
+     * @param ticks Press duration (ticks).
+     */
+    static inline uint8_t pressBucket_(uint32_t ticks) noexcept
+    {
+        uint8_t k = 0;
+        while (k + 1u < UB::kPressBuckets && ticks >= ((static_cast<uint32_t>(32u) * Time::kTicksPerMs) << k))
+            ++k;
+        return k;
+    }
+#endif
+
+    /**
+     * @brief Effective debounce window for a button.
+     * @param i Button index.
+     */
+    inline uint32_t debounceMs_(size_t i) const noexcept
+    {
+#if UB_ADAPTIVE_DEBOUNCE
+        if (adapt_max_ != 0u)
+            return learned_[i];
+#endif
+        return st_.debounceMs(i);
+    }
+
+#if UB_ADAPTIVE_DEBOUNCE
+    /**
+     * @brief Clamp a window into the learning bounds.
+     * @param ticks Window (ticks).
+     */
+    inline Learn clampLearned_(uint32_t ticks) const noexcept
+    {
+        if (ticks < adapt_min_)
+            return static_cast<Learn>(adapt_min_);
+        return static_cast<Learn>((ticks > adapt_max_) ? adapt_max_ : ticks);
+    }
+
+    /**
+     * @brief Window that covers a measured burst with a 50% margin.
+     * @param burst Burst length (ticks): first to last raw edge.
+     */
+    inline Learn learnTarget_(uint32_t burst) const noexcept
+    {
+        return clampLearned_(burst + (burst >> 1) + 1U);
+    }
+
+    /**
+     * @brief Grow the learned window when a raw edge extends the current bounce burst.
+     * @param i Button index.
+     * @param now Time of the edge (ticks), before lastChange is updated.
+     * @note An edge more than the upper bound after the previous one starts a new burst.
+     *       Growth is immediate, so a bounce that escaped the window is not missed twice.
+     */
+    inline void learnEdge_(size_t i, uint32_t now) noexcept
+    {
+        if (adapt_max_ == 0u)
+            return;
+        if ((now - st_.lastChange(i, now)) > adapt_max_)
+        {
+            burst_start_[i] = static_cast<Learn>(now);
+            return;
+        }
+        const Learn target = learnTarget_(static_cast<Learn>(static_cast<Learn>(now) - burst_start_[i]));
+        if (target > learned_[i])
+            learned_[i] = target;
+    }
+
+    /**
+     * @brief Shrink the learned window towards the burst that just settled.
+     * @param i Button index.
+     * @param now Commit time (ticks).
+     * @note Moves 1/8 of the way per commit, so one quiet press cannot undo a noisy history.
+     */
+    inline void learnCommit_(size_t i, uint32_t now) noexcept
+    {
+        if (adapt_max_ == 0u)
+            return;
+        const Learn burst = static_cast<Learn>(static_cast<Learn>(st_.lastChange(i, now)) - burst_start_[i]);
+        const Learn target = learnTarget_(burst);
+        if (target < learned_[i])
+            learned_[i] = static_cast<Learn>(learned_[i] - ((learned_[i] - target + 7u) >> 3));
+    }
+#endif
+
+    /**
+     * @brief Effective short-press threshold for a button.
+     * @param i Button index.
+     */
+    inline uint32_t shortMs_(size_t i) const noexcept { return st_.shortMs(i); }
+
+    /**
+     * @brief Effective long-press threshold for a button.
+     * @param i Button index.
+     */
+    inline uint32_t longMs_(size_t i) const noexcept { return st_.longMs(i); }
+
+    /**
+     * @brief Effective double-click window for a button.
+     * @param i Button index.
+     */
+    inline uint32_t doubleMs_(size_t i) const noexcept { return st_.doubleMs(i); }
+
+    /**
+     * @brief Effective hold time before the first Repeat (0 = button does not repeat).
+     * @param i Button index.
+     */
+    inline uint32_t repeatDelayMs_(size_t i) const noexcept { return st_.repeatDelayMs(i); }
+
+    /**
+     * @brief Gap after the latest Repeat, accelerated by the number of repeats so far.
+     * @param i Button index (repeat_count_[i] >= 1).
+     * @return Gap in ms (at least 1).
+     */
+    inline uint32_t repeatGapMs_(size_t i) const noexcept
+    {
+        const uint32_t base = st_.repeatIntervalMs(i);
+        const uint32_t floor = (timing_.repeat_min_ms < base) ? timing_.repeat_min_ms : base;
+        const uint32_t cut = timing_.repeat_accel_ms * static_cast<uint32_t>(repeat_count_[i] - 1u);
+        const uint32_t gap = (base - floor > cut) ? base - cut : floor;
+        return gap ? gap : 1U;
+    }
+
+    /**
+     * @brief Rebuild one button's behaviour bits (repeat_mask_, long_hold_mask_, early_mask_, eager_mask_).
+     * @param i Button index.
+     */
+    inline void refreshFlags_(size_t i) noexcept
+    {
+        const UB::layout::Behavior &c = st_.behavior(i);
+        UB::bits::assign(repeat_mask_, i, repeatDelayMs_(i) != 0U);
+        UB::bits::assign(long_hold_mask_, i, c.long_on_hold);
+        UB::bits::assign(early_mask_, i, c.early_short);
+        UB::bits::assign(eager_mask_, i, c.eager_samples != 0u);
+    }
+
+    /**
+     * @brief Rebuild the behaviour bits of every button (configuration path only).
+     */
+    inline void refreshFlagsAll_() noexcept
+    {
+        for (size_t i = 0; i < N; ++i)
+            refreshFlags_(i);
+    }
+
+    /**
+     * @brief Whether a held button is waiting for its next Repeat.
+     * @param i Button index.
+     */
+    inline bool repeatArmed_(size_t i) const noexcept
+    {
+        return UB::bits::test(repeat_mask_, i) && UB::bits::test(last_state_, i) && st_.hasPress(i);
+    }
+
+    /**
+     * @brief Whether a held long_on_hold button has yet to reach its Long threshold.
+     * @param i Button index.
+     */
+    inline bool longArmed_(size_t i) const noexcept
+    {
+        return UB::bits::test(long_hold_mask_, i) && !UB::bits::test(long_fired_, i) &&
+               UB::bits::test(last_state_, i) && st_.hasPress(i);
+    }
+
+    /**
+     * @brief Absolute due time of the next Repeat for an armed button.
+     * @param i Button index.
+     * @param ref Current processing time (rebuilds compact timestamps).
+     * @note The time of the latest Repeat is kept in the pending-since slot, which is free
+     *       while a button repeats (a pending Short is flushed by the first Repeat).
+     */
+    inline uint32_t repeatDue_(size_t i, uint32_t ref) const noexcept
+    {
+        if (repeat_count_[i] == 0u)
+            return st_.pressStart(i, ref) + repeatDelayMs_(i);
+        return st_.pendingSince(i, ref) + repeatGapMs_(i);
+    }
+
+    /**
+     * @brief Earliest hold event (Long on hold or Repeat) of a held button.
+     * @param i Button index.
+     * @param ref Current processing time (rebuilds compact timestamps).
+     * @param due Receives the absolute due time (ms).
+     * @return false if the button has no hold event armed.
+     */
+    inline bool holdDue_(size_t i, uint32_t ref, uint32_t &due) const noexcept
+    {
+        bool any = false;
+        if (longArmed_(i))
+        {
+            due = st_.pressStart(i, ref) + longMs_(i);
+            any = true;
+        }
+        if (repeatArmed_(i))
+        {
+            const uint32_t rep = repeatDue_(i, ref);
+            if (!any || static_cast<int32_t>(rep - due) < 0)
+                due = rep;
+            any = true;
+        }
+        return any;
+    }
+
+    /**
+     * @brief Emit a pending Short right away (a hold event of the next press supersedes its window).
+     * @param i Button index.
+     * @param now Current time (ms).
+     */
+    inline void flushShortNow_(size_t i, uint32_t now) noexcept
+    {
+        if (!UB::bits::test(pending_short_, i))
+            return;
+        UB::bits::assign(pending_short_, i, false);
+        if (UB::bits::test(early_mask_, i))
+            return; ///< Already emitted on release.
+        emitShort_(i, now);
+    }
+
+    /**
+     * @brief Emit hold events that are due for a held button: Long (long_on_hold), then Repeat.
+     * @param i Button index.
+     * @param now Current time (ms).
+     * @note A Short still waiting for its double-click window is older, so it is delivered first.
+     * @note Repeats keep a steady cadence; after a stall longer than one gap the cadence
+     *       restarts at @p now instead of bursting.
+     */
+    inline void holdStep_(size_t i, uint32_t now) noexcept
+    {
+#if UB_CHORDS > 0
+        if (UB::bits::test(chord_used_, i))
+            return; ///< The chord took over this press.
+#endif
+        if (longArmed_(i) && static_cast<int32_t>(now - (st_.pressStart(i, now) + longMs_(i))) >= 0)
+        {
+            flushShortNow_(i, now);
+            UB::bits::assign(long_fired_, i, true);
+            emit_(i, ButtonPressType::Long, now - st_.pressStart(i, now), now);
+        }
+
+        if (!repeatArmed_(i))
+            return;
+        const uint32_t due = repeatDue_(i, now);
+        if (static_cast<int32_t>(now - due) < 0)
+            return;
+
+        flushShortNow_(i, now);
+        emit_(i, ButtonPressType::Repeat, now - st_.pressStart(i, now), now);
+        if (repeat_count_[i] != 0xFFu)
+            ++repeat_count_[i];
+        st_.setPendingSince(i, ((now - due) < repeatGapMs_(i)) ? due : now);
+    }
+
+    /**
+     * @brief Sample all enabled buttons into a packed raw bitmap (after polarity).
+     * @param raw Destination bitmap of kWords words; bit i == button i raw-pressed.
+     * @note Bank readers are called once; per-button readers once per enabled button.
+     */
+    inline void sample_(uint32_t *raw) noexcept
+    {
+        for (size_t w = 0; w < kWords; ++w)
+            raw[w] = 0U;
+
+        if (read_bank_fn_)
+        {
+            read_bank_fn_(bank_ctx_, raw, kWords);
+
+            // Apply active level word-wide and drop disabled (and padding) bits.
+            for (size_t w = 0; w < kWords; ++w)
+                raw[w] = (raw[w] ^ invert_[w]) & enabled_[w];
+            return;
+        }
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            // Skip disabled buttons entirely.
+            if (!UB::bits::test(enabled_, i))
+                continue;
+
+            const bool active_low = !UB::bits::test(invert_, i);
+
+            // Read raw physical level: prefer fast per-pin fn, else ctx-callback, else native.
+            const bool pressed_default =
+                (read_pin_fn_) ? read_pin_fn_(pins_[i])
+                               : (read_fn_ ? read_fn_(read_ctx_, pins_[i]) : readNative_(pins_[i], active_low));
+
+            // Apply active level (default: active-low => pressed when LOW).
+            if (active_low ? pressed_default : !pressed_default)
+                UB::bits::assign(raw, i, true);
+        }
+    }
+
+    /**
+     * @brief Default engine: per-button timer, commit once raw has been stable for debounce_ms.
+     * @param raw Packed raw bitmap from sample_().
+     * @param now Current time (ms).
+     */
+    inline void debounceTimed_(const uint32_t *raw, uint32_t now) noexcept
+    {
+        // Active set: a button needs the state machine only if it has a raw edge, an open
+        // debounce window, a held press, or a pending Short. Each of those leaves a bit set
+        // in one of these words; disabled buttons are always zero in all of them.
+        uint32_t active[kWords];
+        uint32_t any = 0U;
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            active[w] = raw[w] | last_state_read_[w] | last_state_[w] | pending_short_[w];
+            any |= active[w];
+        }
+
+        // All idle: nothing can change this scan.
+        if (any == 0U)
+            return;
+
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            uint32_t m = active[w];
+            while (m)
+            {
+                const size_t i = (w << 5) + UB::bits::lowestSet(m);
+                m &= m - 1u;
+
+                stepTimed_(i, UB::bits::test(raw, i), now);
+            }
+        }
+    }
+
+    /**
+     * @brief Run the timed debouncer and classifier for one button.
+     * @param i Button index.
+     * @param r Raw (post-polarity) level at @p now.
+     * @param now Current time (ms).
+     * @param holds false leaves due hold events (Long on hold, Repeat) to the time-ordered
+     *        settle pass (edge steps), so same-millisecond events keep button-index order as in polling.
+     */
+    inline void stepTimed_(size_t i, bool r, uint32_t now, bool holds = true) noexcept
+    {
+        const bool eager = UB::bits::test(eager_mask_, i);
+
+        // Debounce: restart window on any raw edge (eager buttons keep their lockout instead).
+        if (r != UB::bits::test(last_state_read_, i))
+        {
+#if UB_STATS
+            // Raw moving back to the committed level means the window was already open.
+            if (r == UB::bits::test(last_state_, i))
+                countBounce_(i);
+#endif
+            UB::bits::assign(last_state_read_, i, r);
+            if (!eager)
+            {
+#if UB_ADAPTIVE_DEBOUNCE
+                learnEdge_(i, now);
+#endif
+                st_.setLastChange(i, now);
+            }
+        }
+
+        if (eager)
+        {
+            // Leading edge: commit once enough differing scans follow the lockout, then lock again.
+            if (UB::bits::test(last_state_, i) == r)
+                agree_[i] = 0;
+            else if (eagerReady_(i, now))
+            {
+                st_.setLastChange(i, now);
+                commit_(i, r, now);
+            }
+        }
+        else if (UB::bits::test(last_state_, i) != r && (now - st_.lastChange(i, now)) >= debounceMs_(i))
+        {
+            // Raw differs from committed and has been stable long enough: commit it.
+#if UB_ADAPTIVE_DEBOUNCE
+            learnCommit_(i, now);
+#endif
+            commit_(i, r, now);
+        }
+
+        if (holds)
+            holdStep_(i, now);
+        flushPending_(i, now);
+    }
+
+    /**
+     * @brief Count one differing scan of an eager button; true once it may commit.
+     * @param i Button index.
+     * @param now Scan time (ms).
+     * @note Scans inside the lockout (debounce_ms after the previous commit) do not count.
+     */
+    inline bool eagerReady_(size_t i, uint32_t now) noexcept
+    {
+        if ((now - st_.lastChange(i, now)) < debounceMs_(i))
+            return false;
+        if (agree_[i] != 0xFFu)
+            ++agree_[i];
+        if (agree_[i] < st_.behavior(i).eager_samples)
+            return false;
+        agree_[i] = 0;
+        return true;
+    }
+
+    /**
+     * @brief Next time the timed engine can change one button without new input.
+     * @param i Button index.
+     * @param ref Current processing time (rebuilds compact timestamps).
+     * @param due Receives the absolute due time (ms).
+     * @return false if the button has no running debounce, double-click, or hold timer.
+     * @note A pending Short only counts once raw and committed state are both released.
+     */
+    inline bool timerDue_(size_t i, uint32_t ref, uint32_t &due) const noexcept
+    {
+        const bool r = UB::bits::test(last_state_read_, i);
+        bool any = false;
+        if (UB::bits::test(last_state_, i) != r)
+        {
+            // Eager buttons: the lockout end, or every scan while samples are being confirmed.
+            due = st_.lastChange(i, ref) + debounceMs_(i);
+            if (UB::bits::test(eager_mask_, i) && st_.behavior(i).eager_samples > 1u &&
+                static_cast<int32_t>(ref - due) >= 0)
+                due = ref;
+            any = true;
+        }
+        else if (UB::bits::test(pending_short_, i) && !r && !shortQueued_(i))
+        {
+            due = st_.pendingSince(i, ref) + doubleMs_(i);
+            any = true;
+        }
+        uint32_t hold;
+        if (holdDue_(i, ref, hold))
+        {
+            if (!any || static_cast<int32_t>(hold - due) < 0)
+                due = hold;
+            any = true;
+        }
+        return any;
+    }
+
+#if UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_INTEGRATOR
+    /**
+     * @brief Word-parallel engine: shift-register integrator over the last UB_DEBOUNCE_SAMPLES scans.
+     * @param raw Packed raw bitmap from sample_().
+     * @param now Current time (ms).
+     * @note A bit commits to 1 when every stored sample is 1 and to 0 when every stored sample
+     *       is 0; otherwise it holds. Only committed transitions reach the per-button classifier.
+     */
+    inline void debounceIntegrator_(const uint32_t *raw, uint32_t now) noexcept
     {
-        return getAndClearLatchedChanged(static_cast<uint8_t>(buttonId));
-    }
+        // Idle fast path: once UB_DEBOUNCE_SAMPLES released scans have been recorded the
+        // history is all zero, so further released scans cannot change anything.
+        uint32_t active = 0U;
+        for (size_t w = 0; w < kWords; ++w)
+            active |= raw[w] | last_state_read_[w] | last_state_[w] | pending_short_[w];
 
-private:
-    // ---- Storage ---- //
+        if (active == 0U)
+        {
+            if (quiet_scans_ >= UB_DEBOUNCE_SAMPLES)
+                return;
+            ++quiet_scans_;
+        }
+        else
+        {
+            quiet_scans_ = 0;
+        }
 
-    uint8_t pins_[N]{};                       ///< Pin or logical IDs.
-    bool last_state_[N];                      ///< Last committed (debounced) state.
-    bool last_state_read_[N]{};               ///< Most recent raw state (after polarity).
-    uint32_t last_state_change_[N];           ///< Timestamp (ms) when raw state last changed.
-    uint32_t press_start_[N];                 ///< Timestamp (ms) when press started (committed).
-    bool has_press_start_[N]{};               ///< True when press_start_ holds a valid timestamp.
-    ButtonPressType event_[N];                ///< Pending event (short/long/double) per button.
-    bool pending_short_[N]{};                 ///< Pending single waiting for possible double.
-    uint32_t pending_since_[N]{};             ///< Timestamp (ms) of first short release.
-    ButtonPerConfig per_[N];                  ///< Per-button overrides (timing, polarity, enable).
-    ButtonTimingConfig timing_;               ///< Global debounce and press-duration configuration.
-    uint32_t last_duration_[N];               ///< Last measured press duration (ms), set on release.
-    UB::compat::bitset<N> latched_{};         ///< Latched state per button.
-    UB::compat::bitset<N> latched_changed_{}; ///< Edge flag: latched state changed since last clear.
+        uint32_t *slot = hist_[hist_pos_];
+        hist_pos_ = static_cast<uint8_t>((hist_pos_ + 1u) % UB_DEBOUNCE_SAMPLES);
 
-    // ---- Readers ---- //
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            // Timestamp raw edges (kept for duration/diagnostic parity with the timed engine).
+            uint32_t edges = raw[w] ^ last_state_read_[w];
+            last_state_read_[w] = raw[w];
+#if UB_STATS
+            // Edges back to the committed level happen inside an open window.
+            uint32_t bounced = edges & ~(raw[w] ^ last_state_[w]);
+            while (bounced)
+            {
+                countBounce_((w << 5) + UB::bits::lowestSet(bounced));
+                bounced &= bounced - 1u;
+            }
+#endif
+            while (edges)
+            {
+                st_.setLastChange((w << 5) + UB::bits::lowestSet(edges), now);
+                edges &= edges - 1u;
+            }
 
-    ReadPinFn read_pin_fn_{nullptr}; ///< Optional fast-path reader (per-pin).
-    ReadFn read_fn_{nullptr};        ///< Optional context-aware reader.
-    void *read_ctx_{nullptr};        ///< Opaque context for @c read_fn_.
+            slot[w] = raw[w];
 
-    // ---- Time source ---- //
+            uint32_t all = ~static_cast<uint32_t>(0U);
+            uint32_t any = 0U;
+            for (size_t s = 0; s < UB_DEBOUNCE_SAMPLES; ++s)
+            {
+                all &= hist_[s][w];
+                any |= hist_[s][w];
+            }
 
-    TimeFn time_fn_{nullptr};
+            const uint32_t next = (all | (last_state_[w] & any)) & enabled_[w];
+            uint32_t changed = next ^ last_state_[w];
+            while (changed)
+            {
+                const size_t i = (w << 5) + UB::bits::lowestSet(changed);
+                commit_(i, UB::bits::test(&next, i & 31u), now);
+                changed &= changed - 1u;
+            }
+        }
+
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            uint32_t m = last_state_[w] & (repeat_mask_[w] | long_hold_mask_[w]);
+            while (m)
+            {
+                holdStep_((w << 5) + UB::bits::lowestSet(m), now);
+                m &= m - 1u;
+            }
+
+            m = pending_short_[w];
+            while (m)
+            {
+                flushPending_((w << 5) + UB::bits::lowestSet(m), now);
+                m &= m - 1u;
+            }
+        }
+    }
 
     /**
-     * @brief Configure a native Arduino GPIO pin when Arduino support is available.
-     * @param pin MCU GPIO pin number.
-     * @note Outside Arduino builds this is intentionally a no-op; use skipPinInit=true
-     *       and configure inputs in the platform adapter/application.
+     * @brief Clear the integrator sample history (all samples released).
      */
-    static inline void initPin_(uint8_t pin) noexcept
+    inline void clearHistory_() noexcept
     {
-#if UB_HAS_ARDUINO
-        pinMode(pin, INPUT_PULLUP);
+        for (size_t s = 0; s < UB_DEBOUNCE_SAMPLES; ++s)
+            for (size_t w = 0; w < kWords; ++w)
+                hist_[s][w] = 0U;
+        hist_pos_ = 0;
+        quiet_scans_ = 0;
+    }
+#endif
+
+#if UB_EDGE_QUEUE_SIZE > 0
+    /**
+     * @brief Consume all queued edges, applying each at its own timestamp.
+     * @param now Time (ms) of this update().
+     * @note With the timed engine, timers that expired before an edge (or before @p now)
+     *       fire first at their exact due time, so commits, durations, Short/Double
+     *       decisions, and event timestamps do not depend on how often update() runs.
+     */
+    inline void drainEdges_(uint32_t now) noexcept
+    {
+        uint8_t tail = edge_tail_;
+        const uint8_t head = edge_head_;
+        UB_COMPILER_BARRIER();
+
+        while (tail != head)
+        {
+            const uint8_t id = edges_[tail].id;
+            const bool level = edges_[tail].level;
+#if UB_DEBOUNCE_ENGINE != UB_DEBOUNCE_INTEGRATOR
+            // An edge queued after update() read its clock is applied at now; a later stamp
+            // would put lastChange ahead of now and make the debounce window wrap.
+            uint32_t ts = edges_[tail].ts;
+            if (static_cast<int32_t>(ts - now) > 0)
+                ts = now;
+#endif
+            tail = static_cast<uint8_t>((tail + 1u) & (UB_EDGE_QUEUE_SIZE - 1u));
+
+            if (id >= N)
+                continue;
+
+            // Apply active level (default: active-low => pressed when LOW).
+            const bool r = (level != UB::bits::test(invert_, id));
+            UB::bits::assign(edge_level_, id, r);
+
+#if UB_DEBOUNCE_ENGINE != UB_DEBOUNCE_INTEGRATOR
+            if (UB::bits::test(enabled_, id))
+            {
+                settleUntil_(ts);
+                // An eager edge can commit (and emit) right here; lower buttons due at ts go first.
+                if (UB::bits::test(eager_mask_, id))
+                    settleAt_(ts, id);
+                stepTimed_(id, r, ts, false);
+            }
+#endif
+        }
+
+        UB_COMPILER_BARRIER();
+        edge_tail_ = tail;
+
+#if UB_DEBOUNCE_ENGINE != UB_DEBOUNCE_INTEGRATOR
+        // Timers that expired after the last edge fire at their due time too; anything due
+        // exactly now is left to the regular scan.
+        settleUntil_(now);
 #else
-        (void)pin;
+        (void)now;
 #endif
     }
 
+#if UB_DEBOUNCE_ENGINE != UB_DEBOUNCE_INTEGRATOR
     /**
-     * @brief Read a native Arduino GPIO button using the library default polarity.
-     * @param pin MCU GPIO pin number.
-     * @param activeLow Current button polarity.
-     * @return true when the pin reads LOW on Arduino; inactive fallback when no native GPIO API exists.
-     * @note Non-Arduino builds should provide ReadPinFn/ReadFn readers instead of relying
-     *       on the native GPIO fallback.
+     * @brief Fire every timer that expires strictly before @p ts, in due-time order.
+     * @param ts Timestamp (ms) of the next edge, or of this update().
+     * @note Each timer runs stepTimed_() at its own due time, exactly as a poll at that
+     *       millisecond would, so events from different buttons stay time-ordered.
      */
-    static inline bool readNative_(uint8_t pin, bool activeLow) noexcept
+    inline void settleUntil_(uint32_t ts) noexcept
     {
-#if UB_HAS_ARDUINO
-        (void)activeLow;
-        return digitalRead(pin) == LOW;
+        for (;;)
+        {
+            size_t best = N;
+            uint32_t bestDue = 0U;
+            uint32_t bestLead = 0U; ///< How far before ts the best timer expired.
+            for (size_t w = 0; w < kWords; ++w)
+            {
+                uint32_t m = ((last_state_read_[w] ^ last_state_[w]) | pending_short_[w] |
+                              (last_state_[w] & (repeat_mask_[w] | long_hold_mask_[w]))) &
+                             enabled_[w];
+                while (m)
+                {
+                    const size_t i = (w << 5) + UB::bits::lowestSet(m);
+                    m &= m - 1u;
+
+                    // An unread event holds back a pending Short (see flushPending_()); hold events are not
+                    // held back. With the queue the Short timer still fires once, for the FIFO copy.
+                    if (st_.event(i) != ButtonPressType::None && !UB::bits::test(last_state_, i) &&
+                        !UB::bits::test(last_state_read_, i) && !UB::bits::test(early_mask_, i) &&
+                        shortHeld_(i))
+                        continue;
+                    uint32_t due = 0U;
+                    if (!timerDue_(i, ts, due))
+                        continue;
+                    const uint32_t lead = ts - due;
+                    if (static_cast<int32_t>(lead) > 0 && lead > bestLead)
+                    {
+                        best = i;
+                        bestDue = due;
+                        bestLead = lead;
+                    }
+                }
+            }
+            if (best == N)
+                return;
+            stepTimed_(best, UB::bits::test(last_state_read_, best), bestDue);
+        }
+    }
+
+    /**
+     * @brief Run buttons below @p below whose timer is due exactly at @p ts, in index order.
+     * @param ts Timestamp (ms) of the edge being applied.
+     * @param below Index of the edge's button.
+     * @note Keeps same-millisecond events in button-index order, as a poll at @p ts would.
+     */
+    inline void settleAt_(uint32_t ts, size_t below) noexcept
+    {
+        for (size_t w = 0; w <= (below >> 5); ++w)
+        {
+            uint32_t m = ((last_state_read_[w] ^ last_state_[w]) | pending_short_[w] |
+                          (last_state_[w] & (repeat_mask_[w] | long_hold_mask_[w]))) &
+                         enabled_[w];
+            if (w == (below >> 5))
+                m &= (static_cast<uint32_t>(1u) << (below & 31u)) - 1u;
+            while (m)
+            {
+                const size_t i = (w << 5) + UB::bits::lowestSet(m);
+                m &= m - 1u;
+
+                uint32_t due = 0U;
+                if (timerDue_(i, ts, due) && due == ts)
+                    stepTimed_(i, UB::bits::test(last_state_read_, i), ts);
+            }
+        }
+    }
+#endif
+
+    /**
+     * @brief Drop all queued edges (used after re-seeding levels from the readers).
+     */
+    inline void discardEdges_() noexcept
+    {
+        edge_tail_ = edge_head_;
+    }
+#endif
+
+    /**
+     * @brief Commit a debounced transition and classify the press on release.
+     * @param i Button index.
+     * @param pressed New committed state.
+     * @param now Current time (ms).
+     */
+    inline void commit_(size_t i, bool pressed, uint32_t now) noexcept
+    {
+        UB::bits::assign(last_state_, i, pressed);
+
+        if (pressed)
+        {
+            // Transition: released -> pressed (commit).
+            st_.setPressStart(i, now);
+            st_.setHasPress(i, true);
+            repeat_count_[i] = 0;
+            UB::bits::assign(long_fired_, i, false);
+#if UB_CHORDS > 0
+            UB::bits::assign(chord_used_, i, false);
+#endif
+            return;
+        }
+
+        // Transition: pressed -> released (commit).
+        const uint32_t duration = st_.hasPress(i) ? (now - st_.pressStart(i, now)) : 0U;
+        st_.setDuration(i, duration); ///< Record exact duration for retrieval.
+#if UB_STATS
+        if (st_.hasPress(i))
+            ++stats_.press_hist[pressBucket_(duration)];
+#endif
+
+        bool held = repeat_count_[i] != 0u || UB::bits::test(long_fired_, i);
+#if UB_CHORDS > 0
+        held = held || UB::bits::test(chord_used_, i);
+        UB::bits::assign(chord_used_, i, false);
+#endif
+        if (held)
+        {
+            // The hold already produced its events (Repeat, Long on hold, Chord); the release adds none.
+            repeat_count_[i] = 0;
+            UB::bits::assign(long_fired_, i, false);
+            st_.setPressStart(i, 0);
+            st_.setHasPress(i, false);
+            return;
+        }
+
+        if (duration >= longMs_(i))
+        {
+            emit_(i, ButtonPressType::Long, duration, now);
+        }
+        else if (duration >= shortMs_(i))
+        {
+            // Short press: either completes a double or starts a pending single.
+            if (UB::bits::test(pending_short_, i) && (now - st_.pendingSince(i, now)) <= doubleMs_(i))
+            {
+                UB::bits::assign(pending_short_, i, false);
+                emit_(i, ButtonPressType::Double, duration, now);
+            }
+            else
+            {
+                // Defer emitting Short; it will fire if no 2nd press arrives within dcms.
+                // Early-Short buttons emit it now and only keep the window open for a Double.
+                UB::bits::assign(pending_short_, i, true);
+                st_.setPendingSince(i, now);
+                pending_duration_[i] = duration;
+#if UB_EVENT_QUEUE_SIZE > 0
+                UB::bits::assign(short_queued_, i, false);
+#endif
+                if (UB::bits::test(early_mask_, i))
+                    emit_(i, ButtonPressType::Short, duration, now);
+                // Otherwise no finalized event yet => do not apply latch here.
+            }
+        }
+        else
+        {
+            st_.event(i) = ButtonPressType::None;
+            UB::bits::assign(event_bits_, i, false);
+        }
+
+        st_.setPressStart(i, 0);
+        st_.setHasPress(i, false);
+    }
+
+    /**
+     * @brief Emit a deferred Short once the double-click window has expired.
+     * @param i Button index.
+     * @param now Current time (ms).
+     * @note Flushes ONLY when both raw and debounced state are released. This prevents a
+     *       "pending Short" from firing while a second press is already in progress but
+     *       still inside the debounce window.
+     * @note The Short also waits until the per-button slot has been read so it cannot
+     *       overwrite an unread event. With the event queue it is still pushed to the FIFO
+     *       once, on time, and only the slot copy waits.
+     * @note Early-Short buttons emitted their Short on release; this only closes the window.
+     */
+    inline void flushPending_(size_t i, uint32_t now) noexcept
+    {
+        if (!UB::bits::test(pending_short_, i))
+            return;
+        const bool early = UB::bits::test(early_mask_, i);
+        const uint32_t dt = now - st_.pendingSince(i, now);
+        const bool expired =
+            !UB::bits::test(last_state_, i) && !UB::bits::test(last_state_read_, i) && (dt >= doubleMs_(i));
+
+        if (!early && st_.event(i) != ButtonPressType::None)
+        {
+#if UB_EVENT_QUEUE_SIZE > 0
+            if (expired && !UB::bits::test(short_queued_, i))
+            {
+                UB::bits::assign(short_queued_, i, true);
+                deliver_(i, ButtonPressType::Short, pending_duration_[i], now);
+            }
+#endif
+            return;
+        }
+
+        if (expired)
+        {
+            UB::bits::assign(pending_short_, i, false);
+            if (early)
+                return; ///< Short went out on release; the Double window just closed.
+            emitShort_(i, now);
+        }
+    }
+
+    /**
+     * @brief True once a held-back pending Short has nothing left to do until its slot is read.
+     * @param i Button index.
+     * @note Without the queue that is always the case; with it, once the FIFO copy went out.
+     */
+    inline bool shortHeld_(size_t i) const noexcept
+    {
+#if UB_EVENT_QUEUE_SIZE > 0
+        return UB::bits::test(short_queued_, i);
 #else
-        (void)pin;
-        // Return the value that becomes "not pressed" after the active_low transform below.
-        return activeLow ? false : true;
+        (void)i;
+        return true;
 #endif
     }
 
     /**
-     * @brief Resolve the current time in ms. Uses injected TimeFn when provided, otherwise Arduino millis().
-     * @note Outside Arduino builds, pass TimeFn or call update(now); otherwise this returns 0.
+     * @brief True if the pending Short of button @p i already went to the FIFO (never without the queue).
+     * @param i Button index.
      */
-    inline uint32_t time_now() const noexcept
+    inline bool shortQueued_(size_t i) const noexcept
     {
-        if (time_fn_)
-            return time_fn_();
-#if UB_HAS_ARDUINO
-        return millis();
+#if UB_EVENT_QUEUE_SIZE > 0
+        return UB::bits::test(short_queued_, i);
 #else
-        return 0U;
+        (void)i;
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Publish the pending Short of button @p i with the duration saved when it was deferred.
+     * @param i Button index.
+     * @param now Current time (ms).
+     * @note A Short already pushed to the FIFO while held back only fills the slot and latch.
+     */
+    inline void emitShort_(size_t i, uint32_t now) noexcept
+    {
+#if UB_EVENT_QUEUE_SIZE > 0
+        if (UB::bits::test(short_queued_, i))
+        {
+            UB::bits::assign(short_queued_, i, false);
+            post_(i, ButtonPressType::Short);
+            return;
+        }
+#endif
+        emit_(i, ButtonPressType::Short, pending_duration_[i], now);
+    }
+
+    /**
+     * @brief Copy packed state words to a caller buffer, zero-filling past kWords.
+     * @param src Internal word array (kWords long).
+     * @param out Destination.
+     * @param nwords Words available in @p out.
+     */
+    static inline void copyWords_(const uint32_t *src, uint32_t *out, size_t nwords) noexcept
+    {
+        for (size_t w = 0; w < nwords; ++w)
+            out[w] = (w < kWords) ? src[w] : 0U;
+    }
+
+#if UB_CONCURRENT
+    /**
+     * @brief Copy pressed/latched words into the idle snapshot buffer and switch readers to it.
+     * @note Scanner core only. Readers of the other buffer are never disturbed.
+     */
+    inline void publish_() noexcept
+    {
+        const uint8_t b = static_cast<uint8_t>(pub_cur_ ^ 1u);
+        Published &p = pub_[b];
+        p.version = p.version + 1u; ///< Odd: being written.
+        UB_SHARED_FENCE();
+        p.count = ++pub_count_;
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            p.pressed[w] = last_state_[w];
+            p.latched[w] = latched_[w];
+        }
+        UB_SHARED_FENCE();
+        p.version = p.version + 1u; ///< Even: stable.
+        UB_SHARED_FENCE();
+        pub_cur_ = b;
+    }
+
+#endif
+    /**
+     * @brief Publish a finalized event: per-button slot, latch, and (if enabled) the FIFO.
+     * @param i Button index.
+     * @param type Short, Long, or Double.
+     * @param duration Duration (ms) of the press behind the event.
+     * @param now Time (ms) the event was finalized.
+     */
+    inline void emit_(size_t i, ButtonPressType type, uint32_t duration, uint32_t now) noexcept
+    {
+        post_(i, type);
+        deliver_(i, type, duration, now);
+    }
+
+    /**
+     * @brief Store an event in the per-button slot (unless an EventFn is set) and apply latching.
+     * @param i Button index.
+     * @param type Event type.
+     */
+    inline void post_(size_t i, ButtonPressType type) noexcept
+    {
+        if (!event_fn_)
+        {
+            st_.event(i) = type;
+            UB::bits::assign(event_bits_, i, true);
+#if UB_STATS
+            ev_ticks_[i] = statsNow_();
+#endif
+        }
+
+        // Finalized event => apply latch now (if configured).
+        applyLatch_(i, type);
+    }
+
+    /**
+     * @brief Hand an event to the EventFn and the FIFO (if enabled).
+     * @param i Button index (chord id for ButtonPressType::Chord).
+     * @param type Event type.
+     * @param duration Duration (ms) behind the event.
+     * @param now Time (ms) the event was finalized.
+     */
+    inline void deliver_(size_t i, ButtonPressType type, uint32_t duration, uint32_t now) noexcept
+    {
+        if (event_fn_)
+        {
+            ButtonEvent ev;
+            ev.timestamp = now;
+            ev.duration = duration;
+            ev.index = static_cast<uint8_t>(i);
+            ev.type = type;
+            event_fn_(event_ctx_, ev);
+        }
+#if UB_EVENT_QUEUE_SIZE > 0
+        const uint8_t next = static_cast<uint8_t>((ev_head_ + 1u) & (UB_EVENT_QUEUE_SIZE - 1u));
+        if (next == ev_tail_)
+        {
+            // Full: keep the older events, count the drop.
+            if (ev_overflow_ != 0xFFFFu)
+                ++ev_overflow_;
+            return;
+        }
+        ButtonEvent &e = events_[ev_head_];
+        e.timestamp = now;
+        e.duration = duration;
+        e.index = static_cast<uint8_t>(i);
+        e.type = type;
+        UB_SHARED_FENCE(); ///< Slot contents before the new head.
+        ev_head_ = next;
 #endif
     }
 
+    /**
+     * @brief Bits of packed word @p w that name real buttons (the last word may be partial).
+     * @param w Word index.
+     */
+    static constexpr uint32_t validMask_(size_t w) noexcept
+    {
+        return ((w + 1u) * 32u <= N) ? 0xFFFFFFFFUL : ((static_cast<uint32_t>(1u) << (N & 31u)) - 1u);
+    }
+
+#if UB_CHORDS > 0
+    /**
+     * @brief Track which chords are held and fire those whose hold time has passed.
+     * @param now Current time (ms).
+     * @note One AND/compare per chord and word against the committed state.
+     */
+    inline void evalChords_(uint32_t now) noexcept
+    {
+        for (uint8_t c = 0; c < chord_count_; ++c)
+        {
+            const uint32_t bit = static_cast<uint32_t>(1u) << c;
+            bool all = true;
+            for (size_t w = 0; w < kWords && all; ++w)
+                all = (last_state_[w] & chord_mask_[c][w]) == chord_mask_[c][w];
+
+            if (!all)
+            {
+                chord_on_ &= ~bit;
+                chord_fired_ &= ~bit;
+                continue;
+            }
+            if ((chord_on_ & bit) == 0U)
+            {
+                chord_on_ |= bit;
+                chord_since_[c] = now;
+            }
+            if ((chord_fired_ & bit) != 0U || (now - chord_since_[c]) < chord_hold_[c])
+                continue;
+
+            chord_fired_ |= bit;
+            chord_events_ |= bit;
+            for (size_t w = 0; w < kWords; ++w)
+                chord_used_[w] |= chord_mask_[c][w];
+            deliver_(c, ButtonPressType::Chord, now - chord_since_[c], now);
+        }
+    }
+#endif
+
     /**
      * @brief Reset all runtime state for a single button index.
      * @param i Button index.
@@ -769,19 +2956,33 @@ private:
      */
     inline void resetButton_(size_t i, uint32_t now) noexcept
     {
-        last_state_[i] = false;
-        last_state_read_[i] = false;
-        last_state_change_[i] = now;
-        press_start_[i] = 0U;
-        has_press_start_[i] = false;
-        event_[i] = ButtonPressType::None;
-        pending_short_[i] = false;
-        pending_since_[i] = 0U;
-        last_duration_[i] = 0U;
+        UB::bits::assign(last_state_, i, false);
+        UB::bits::assign(last_state_read_, i, false);
+#if UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_INTEGRATOR
+        for (size_t s = 0; s < UB_DEBOUNCE_SAMPLES; ++s)
+            UB::bits::assign(hist_[s], i, false);
+#endif
+        st_.setLastChange(i, now);
+        st_.setPressStart(i, 0U);
+        st_.setHasPress(i, false);
+        st_.event(i) = ButtonPressType::None;
+        UB::bits::assign(event_bits_, i, false);
+        UB::bits::assign(pending_short_, i, false);
+#if UB_EVENT_QUEUE_SIZE > 0
+        UB::bits::assign(short_queued_, i, false);
+#endif
+        st_.setPendingSince(i, 0U);
+        st_.setDuration(i, 0U);
+        repeat_count_[i] = 0;
+        agree_[i] = 0;
+        UB::bits::assign(long_fired_, i, false);
+#if UB_CHORDS > 0
+        UB::bits::assign(chord_used_, i, false);
+#endif
 
         // Clear latching state as well (disabled buttons should not report latch changes).
-        latched_.set(i, false);
-        latched_changed_.set(i, false);
+        UB::bits::assign(latched_, i, false);
+        UB::bits::assign(latched_changed_, i, false);
     }
 
     /**
@@ -808,20 +3009,21 @@ private:
     /**
      * @brief Apply latch behavior for a finalized press event.
      * @param i Button index.
-     * @param evt Finalized press event (Short/Long/Double).
+     * @param evt Finalized press event (Short/Long/Double/Repeat).
      */
     inline void applyLatch_(size_t i, ButtonPressType evt) noexcept
     {
-        if (!per_[i].latch_enabled)
+        const UB::layout::Behavior &c = st_.behavior(i);
+        if (!c.latch_enabled)
             return;
 
-        if (!latchMatches_(per_[i].latch_on, evt))
+        if (!latchMatches_(c.latch_on, evt))
             return;
 
-        const bool before = latched_.test(i);
+        const bool before = UB::bits::test(latched_, i);
         bool after = before;
 
-        switch (per_[i].latch_mode)
+        switch (c.latch_mode)
         {
         case LatchMode::Toggle:
             after = !before;
@@ -838,8 +3040,42 @@ private:
 
         if (after != before)
         {
-            latched_.set(i, after);
-            latched_changed_.set(i, true);
+            UB::bits::assign(latched_, i, after);
+            latchEdge_(i, after);
+        }
+    }
+
+    /**
+     * @brief Report one latch edge: LatchFn if set, else the latched-changed flag.
+     * @param i Button index.
+     * @param on New latched state.
+     */
+    inline void latchEdge_(size_t i, bool on) noexcept
+    {
+        if (latch_fn_)
+            latch_fn_(latch_ctx_, static_cast<uint8_t>(i), on);
+        else
+            UB::bits::assign(latched_changed_, i, true);
+    }
+
+    /**
+     * @brief Report the latch edges of several buttons in packed word @p w.
+     * @param w Word index.
+     * @param changed Buttons in word @p w whose latch just changed to @p on.
+     * @param on New latched state of those buttons.
+     */
+    inline void latchEdges_(size_t w, uint32_t changed, bool on) noexcept
+    {
+        if (!latch_fn_)
+        {
+            latched_changed_[w] |= changed;
+            return;
+        }
+        while (changed)
+        {
+            const size_t i = (w << 5) + UB::bits::lowestSet(changed);
+            changed &= changed - 1u;
+            latch_fn_(latch_ctx_, static_cast<uint8_t>(i), on);
         }
     }
 };
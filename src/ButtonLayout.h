@@ -0,0 +1,603 @@
+/**
+ * MIT License
+ *
+ * @brief Memory layout policies for ButtonHandler<N> per-button state.
+ *
+ * @file ButtonLayout.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-14
+ * @copyright Copyright © 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <ButtonCompatibility.h>
+#include <ButtonBits.h>
+#include <ButtonTypes.h>
+
+/**
+ * @brief Named configuration profiles per handler (1..128).
+ * @note Every button starts on profile 0, which holds the default ButtonPerConfig.
+ */
+#ifndef UB_CONFIG_PROFILES
+#define UB_CONFIG_PROFILES 4
+#endif
+
+/**
+ * @brief Extra shared slots for setPerConfig() configurations in UB::layout::Compact (0..127).
+ * @note Buttons with identical ButtonPerConfig timing/latch settings share a slot.
+ */
+#ifndef UB_COMPACT_CONFIGS
+#define UB_COMPACT_CONFIGS 4
+#endif
+
+static_assert(UB_CONFIG_PROFILES >= 1 && UB_CONFIG_PROFILES <= 128, "UB_CONFIG_PROFILES must be in 1..128.");
+static_assert(UB_COMPACT_CONFIGS >= 0 && UB_COMPACT_CONFIGS <= 127, "UB_COMPACT_CONFIGS must be in 0..127.");
+
+namespace UB
+{
+    namespace layout
+    {
+        /**
+         * @brief Struct-of-arrays: one array per field, booleans packed into 32-bit words.
+         * @note Best when update() sweeps one field across many buttons on small MCUs without caches.
+         */
+        struct SoA
+        {
+        };
+
+        /**
+         * @brief Array-of-structs: every hot field of a button in one record.
+         * @note One record (44 bytes) per button, so processing a button touches one
+         *       cache line instead of one line per field. Best for large N on cores with
+         *       a data or flash cache (ESP32, Cortex-M7).
+         */
+        struct AoS
+        {
+        };
+
+        /**
+         * @brief Minimal-RAM layout: 16-bit relative timestamps and a shared config table.
+         * @note About 10 bytes per button plus the shared profile/config slots. Timestamps
+         *       are rebuilt against the current time, so press durations and timing values
+         *       are limited to 65535 ms (longer holds wrap; timing values are clamped).
+         * @note With a sub-millisecond time base (kTicksPerMs > 1) 16 bits would wrap after
+         *       65.5 ms of µs ticks, so timestamps and timings widen to 32 bits; only the
+         *       shared config slots still save RAM.
+         */
+        struct Compact
+        {
+        };
+
+        /**
+         * @brief Resolve one timing field (0 override => global).
+         * @param override Per-button value from ButtonPerConfig.
+         * @param global Value from ButtonTimingConfig.
+         * @return Effective value (ms).
+         */
+        inline uint32_t resolveMs(uint32_t override, uint32_t global) noexcept
+        {
+            return override ? override : global;
+        }
+
+        /**
+         * @brief Resolve the double-click window (ButtonPerConfig::no_double => 0, no window).
+         * @param c Per-button overrides.
+         * @param global Value from ButtonTimingConfig (0 = no window).
+         * @return Effective window (ms).
+         */
+        inline uint32_t resolveDoubleMs(const ButtonPerConfig &c, uint32_t global) noexcept
+        {
+            return c.no_double ? 0U : resolveMs(c.double_click_ms, global);
+        }
+
+        /**
+         * @brief Non-timing ButtonPerConfig fields the handler reads per button.
+         */
+        struct Behavior
+        {
+            bool long_on_hold{false};                   ///< See ButtonPerConfig::long_on_hold.
+            bool early_short{false};                    ///< See ButtonPerConfig::early_short.
+            uint8_t eager_samples{0};                   ///< See ButtonPerConfig::eager_samples.
+            bool latch_enabled{false};                  ///< See ButtonPerConfig::latch_enabled.
+            LatchMode latch_mode{LatchMode::Toggle};    ///< See ButtonPerConfig::latch_mode.
+            LatchTrigger latch_on{LatchTrigger::Short}; ///< See ButtonPerConfig::latch_on.
+            bool latch_initial{false};                  ///< See ButtonPerConfig::latch_initial.
+        };
+
+        /**
+         * @brief Copy the non-timing fields of a ButtonPerConfig.
+         * @param c Overrides.
+         */
+        inline Behavior behaviorOf(const ButtonPerConfig &c) noexcept
+        {
+            Behavior b;
+            b.long_on_hold = c.long_on_hold;
+            b.early_short = c.early_short;
+            b.eager_samples = c.eager_samples;
+            b.latch_enabled = c.latch_enabled;
+            b.latch_mode = c.latch_mode;
+            b.latch_on = c.latch_on;
+            b.latch_initial = c.latch_initial;
+            return b;
+        }
+
+        // Timing fields a button overrides, one bit each (SoA/AoS keep this mask instead of the overrides).
+        constexpr uint8_t kOvDebounce = 1u << 0;       ///< debounce_ms
+        constexpr uint8_t kOvShort = 1u << 1;          ///< short_press_ms
+        constexpr uint8_t kOvLong = 1u << 2;           ///< long_press_ms
+        constexpr uint8_t kOvDouble = 1u << 3;         ///< double_click_ms
+        constexpr uint8_t kOvRepeatDelay = 1u << 4;    ///< repeat_delay_ms
+        constexpr uint8_t kOvRepeatInterval = 1u << 5; ///< repeat_interval_ms
+
+        /**
+         * @brief Which timing fields of @p c are set (non-zero).
+         * @param c Overrides.
+         * @return kOv* bits.
+         */
+        inline uint8_t overridesOf(const ButtonPerConfig &c) noexcept
+        {
+            return static_cast<uint8_t>((c.debounce_ms ? kOvDebounce : 0u) | (c.short_press_ms ? kOvShort : 0u) |
+                                        (c.long_press_ms ? kOvLong : 0u) | ((c.double_click_ms || c.no_double) ? kOvDouble : 0u) |
+                                        (c.repeat_delay_ms ? kOvRepeatDelay : 0u) |
+                                        (c.repeat_interval_ms ? kOvRepeatInterval : 0u));
+        }
+
+        /**
+         * @brief Hot per-button runtime state and per-button configuration, stored
+         *        according to layout policy @p L.
+         *
+         * Every layout exposes the same accessors, so ButtonHandler<N, L> is written
+         * once and the policy only changes where the bytes live. Timestamp getters take
+         * a reference time no earlier than the stored value, which lets compact layouts
+         * rebuild full 32-bit timestamps from fewer bits.
+         *
+         * behavior(i) carries the non-timing settings; enabled / active_low live in the
+         * handler's packed bitsets. SoA/AoS do not keep a button's overrides once resolved:
+         * a kOv* mask records which timing fields it set, so a global timing change only
+         * refreshes the others.
+         *
+         * Profiles: a button either follows one of UB_CONFIG_PROFILES named profiles
+         * (setProfile()) or has its own overrides (setConfig(), profileOf() == kCustomProfile).
+         * defineProfile() retunes every follower; Compact's table update is O(1) because
+         * followers read the profile slot directly, SoA/AoS re-resolve followers on the config
+         * path. (The handler then rebuilds the followers' behaviour bits, O(N) either way.)
+         *
+         * @tparam N Number of buttons.
+         * @tparam L Layout policy (SoA, AoS, or Compact).
+         * @tparam TicksPerMs Time base resolution (Time::kTicksPerMs); Compact sizes its fields by it.
+         */
+        template <size_t N, typename L, uint32_t TicksPerMs = 1>
+        class ButtonState;
+
+        /**
+         * @brief Struct-of-arrays layout.
+         * @tparam N Number of buttons.
+         */
+        template <size_t N, uint32_t TicksPerMs>
+        class ButtonState<N, SoA, TicksPerMs>
+        {
+        public:
+            // ---- Configuration ---- //
+
+            const Behavior &behavior(size_t i) const noexcept { return beh_[i]; } ///< Non-timing settings.
+
+            /**
+             * @brief Resolve one button's overrides against the global timing.
+             * @param i Button index.
+             * @param c Overrides.
+             * @param t Global timing.
+             * @return Always true.
+             */
+            bool setConfig(size_t i, const ButtonPerConfig &c, const ButtonTimingConfig &t) noexcept
+            {
+                profile_[i] = kCustomProfile;
+                apply_(i, c, t);
+                return true;
+            }
+
+            /**
+             * @brief Refresh every non-overridden timing after a global timing change.
+             * @param t Global timing.
+             */
+            void resolveAll(const ButtonTimingConfig &t) noexcept
+            {
+                for (size_t i = 0; i < N; ++i)
+                    resolve_(i, t);
+            }
+
+            /**
+             * @brief Point a button at a profile.
+             * @param i Button index.
+             * @param p Profile index (< UB_CONFIG_PROFILES).
+             * @param t Global timing.
+             */
+            void setProfile(size_t i, uint8_t p, const ButtonTimingConfig &t) noexcept
+            {
+                profile_[i] = p;
+                apply_(i, profiles_[p], t);
+            }
+
+            /**
+             * @brief Replace a profile and retune its followers.
+             * @param p Profile index (< UB_CONFIG_PROFILES).
+             * @param c New profile settings.
+             * @param t Global timing.
+             */
+            void defineProfile(uint8_t p, const ButtonPerConfig &c, const ButtonTimingConfig &t) noexcept
+            {
+                profiles_[p] = c;
+                for (size_t i = 0; i < N; ++i)
+                {
+                    if (profile_[i] == p)
+                        apply_(i, c, t);
+                }
+            }
+
+            const ButtonPerConfig &profile(uint8_t p) const noexcept { return profiles_[p]; } ///< Stored profile settings.
+            uint8_t profileOf(size_t i) const noexcept { return profile_[i]; }                ///< Profile index or kCustomProfile.
+
+            uint32_t debounceMs(size_t i) const noexcept { return debounce_ms_[i]; } ///< Resolved debounce window.
+            uint32_t shortMs(size_t i) const noexcept { return short_ms_[i]; }       ///< Resolved short threshold.
+            uint32_t longMs(size_t i) const noexcept { return long_ms_[i]; }         ///< Resolved long threshold.
+            uint32_t doubleMs(size_t i) const noexcept { return double_ms_[i]; }     ///< Resolved double window.
+            uint32_t repeatDelayMs(size_t i) const noexcept { return repeat_delay_[i]; }       ///< Resolved first-Repeat delay (0 = none).
+            uint32_t repeatIntervalMs(size_t i) const noexcept { return repeat_interval_[i]; } ///< Resolved base Repeat gap.
+
+            // ---- Runtime ---- //
+
+            uint32_t lastChange(size_t i, uint32_t) const noexcept { return last_change_[i]; }     ///< Raw state last changed (ms).
+            void setLastChange(size_t i, uint32_t t) noexcept { last_change_[i] = t; }
+            uint32_t pressStart(size_t i, uint32_t) const noexcept { return press_start_[i]; }     ///< Committed press start (ms).
+            void setPressStart(size_t i, uint32_t t) noexcept { press_start_[i] = t; }
+            uint32_t pendingSince(size_t i, uint32_t) const noexcept { return pending_since_[i]; } ///< First short release (ms).
+            void setPendingSince(size_t i, uint32_t t) noexcept { pending_since_[i] = t; }
+            uint32_t duration(size_t i) const noexcept { return duration_[i]; }                    ///< Last press duration (ms).
+            void setDuration(size_t i, uint32_t d) noexcept { duration_[i] = d; }
+            ButtonPressType &event(size_t i) noexcept { return event_[i]; }                        ///< Pending event slot.
+            ButtonPressType event(size_t i) const noexcept { return event_[i]; }                   ///< Pending event slot.
+            bool hasPress(size_t i) const noexcept { return UB::bits::test(has_press_, i); }       ///< pressStart() is valid.
+            void setHasPress(size_t i, bool v) noexcept { UB::bits::assign(has_press_, i, v); }
+
+        private:
+            uint32_t last_change_[N]{};
+            uint32_t press_start_[N]{};
+            uint32_t pending_since_[N]{};
+            uint32_t duration_[N]{};
+            uint32_t debounce_ms_[N]{};
+            uint32_t short_ms_[N]{};
+            uint32_t long_ms_[N]{};
+            uint32_t double_ms_[N]{};
+            uint32_t repeat_delay_[N]{};
+            uint32_t repeat_interval_[N]{};
+            ButtonPressType event_[N]{};
+            uint32_t has_press_[UB::bits::wordsFor(N)]{};
+            Behavior beh_[N];
+            uint8_t ov_[N]{}; ///< kOv* bits: timing fields the button overrides.
+            ButtonPerConfig profiles_[UB_CONFIG_PROFILES];
+            uint8_t profile_[N]{}; ///< Followed profile or kCustomProfile.
+
+            inline void apply_(size_t i, const ButtonPerConfig &c, const ButtonTimingConfig &t) noexcept
+            {
+                beh_[i] = behaviorOf(c);
+                ov_[i] = overridesOf(c);
+                debounce_ms_[i] = resolveMs(c.debounce_ms, t.debounce_ms);
+                short_ms_[i] = resolveMs(c.short_press_ms, t.short_press_ms);
+                long_ms_[i] = resolveMs(c.long_press_ms, t.long_press_ms);
+                double_ms_[i] = resolveDoubleMs(c, t.double_click_ms);
+                repeat_delay_[i] = resolveMs(c.repeat_delay_ms, t.repeat_delay_ms);
+                repeat_interval_[i] = resolveMs(c.repeat_interval_ms, t.repeat_interval_ms);
+            }
+
+            inline void resolve_(size_t i, const ButtonTimingConfig &t) noexcept
+            {
+                const uint8_t ov = ov_[i];
+                if (!(ov & kOvDebounce))
+                    debounce_ms_[i] = t.debounce_ms;
+                if (!(ov & kOvShort))
+                    short_ms_[i] = t.short_press_ms;
+                if (!(ov & kOvLong))
+                    long_ms_[i] = t.long_press_ms;
+                if (!(ov & kOvDouble))
+                    double_ms_[i] = t.double_click_ms;
+                if (!(ov & kOvRepeatDelay))
+                    repeat_delay_[i] = t.repeat_delay_ms;
+                if (!(ov & kOvRepeatInterval))
+                    repeat_interval_[i] = t.repeat_interval_ms;
+            }
+        };
+
+        /**
+         * @brief Array-of-structs layout (same accessors as ButtonState<N, SoA>).
+         * @tparam N Number of buttons.
+         * @note Behavior settings stay in a separate cold array; only resolved values live in the record.
+         */
+        template <size_t N, uint32_t TicksPerMs>
+        class ButtonState<N, AoS, TicksPerMs>
+        {
+        public:
+            const Behavior &behavior(size_t i) const noexcept { return beh_[i]; }
+
+            bool setConfig(size_t i, const ButtonPerConfig &c, const ButtonTimingConfig &t) noexcept
+            {
+                profile_[i] = kCustomProfile;
+                apply_(i, c, t);
+                return true;
+            }
+
+            void resolveAll(const ButtonTimingConfig &t) noexcept
+            {
+                for (size_t i = 0; i < N; ++i)
+                    resolve_(i, t);
+            }
+
+            void setProfile(size_t i, uint8_t p, const ButtonTimingConfig &t) noexcept
+            {
+                profile_[i] = p;
+                apply_(i, profiles_[p], t);
+            }
+
+            void defineProfile(uint8_t p, const ButtonPerConfig &c, const ButtonTimingConfig &t) noexcept
+            {
+                profiles_[p] = c;
+                for (size_t i = 0; i < N; ++i)
+                {
+                    if (profile_[i] == p)
+                        apply_(i, c, t);
+                }
+            }
+
+            const ButtonPerConfig &profile(uint8_t p) const noexcept { return profiles_[p]; }
+            uint8_t profileOf(size_t i) const noexcept { return profile_[i]; }
+
+            uint32_t debounceMs(size_t i) const noexcept { return rec_[i].debounce_ms; }
+            uint32_t shortMs(size_t i) const noexcept { return rec_[i].short_ms; }
+            uint32_t longMs(size_t i) const noexcept { return rec_[i].long_ms; }
+            uint32_t doubleMs(size_t i) const noexcept { return rec_[i].double_ms; }
+            uint32_t repeatDelayMs(size_t i) const noexcept { return rec_[i].repeat_delay; }
+            uint32_t repeatIntervalMs(size_t i) const noexcept { return rec_[i].repeat_interval; }
+
+            uint32_t lastChange(size_t i, uint32_t) const noexcept { return rec_[i].last_change; }
+            void setLastChange(size_t i, uint32_t t) noexcept { rec_[i].last_change = t; }
+            uint32_t pressStart(size_t i, uint32_t) const noexcept { return rec_[i].press_start; }
+            void setPressStart(size_t i, uint32_t t) noexcept { rec_[i].press_start = t; }
+            uint32_t pendingSince(size_t i, uint32_t) const noexcept { return rec_[i].pending_since; }
+            void setPendingSince(size_t i, uint32_t t) noexcept { rec_[i].pending_since = t; }
+            uint32_t duration(size_t i) const noexcept { return rec_[i].duration; }
+            void setDuration(size_t i, uint32_t d) noexcept { rec_[i].duration = d; }
+            ButtonPressType &event(size_t i) noexcept { return rec_[i].event; }
+            ButtonPressType event(size_t i) const noexcept { return rec_[i].event; }
+            bool hasPress(size_t i) const noexcept { return rec_[i].has_press; }
+            void setHasPress(size_t i, bool v) noexcept { rec_[i].has_press = v; }
+
+        private:
+            /**
+             * @brief Hot fields of one button, timestamps first.
+             */
+            struct Record
+            {
+                uint32_t last_change;
+                uint32_t press_start;
+                uint32_t pending_since;
+                uint32_t duration;
+                uint32_t debounce_ms;
+                uint32_t short_ms;
+                uint32_t long_ms;
+                uint32_t double_ms;
+                uint32_t repeat_delay;
+                uint32_t repeat_interval;
+                ButtonPressType event;
+                bool has_press;
+            };
+
+            Record rec_[N]{};
+            Behavior beh_[N];
+            uint8_t ov_[N]{}; ///< kOv* bits: timing fields the button overrides.
+            ButtonPerConfig profiles_[UB_CONFIG_PROFILES];
+            uint8_t profile_[N]{}; ///< Followed profile or kCustomProfile.
+
+            inline void apply_(size_t i, const ButtonPerConfig &c, const ButtonTimingConfig &t) noexcept
+            {
+                Record &r = rec_[i];
+                beh_[i] = behaviorOf(c);
+                ov_[i] = overridesOf(c);
+                r.debounce_ms = resolveMs(c.debounce_ms, t.debounce_ms);
+                r.short_ms = resolveMs(c.short_press_ms, t.short_press_ms);
+                r.long_ms = resolveMs(c.long_press_ms, t.long_press_ms);
+                r.double_ms = resolveDoubleMs(c, t.double_click_ms);
+                r.repeat_delay = resolveMs(c.repeat_delay_ms, t.repeat_delay_ms);
+                r.repeat_interval = resolveMs(c.repeat_interval_ms, t.repeat_interval_ms);
+            }
+
+            inline void resolve_(size_t i, const ButtonTimingConfig &t) noexcept
+            {
+                Record &r = rec_[i];
+                const uint8_t ov = ov_[i];
+                if (!(ov & kOvDebounce))
+                    r.debounce_ms = t.debounce_ms;
+                if (!(ov & kOvShort))
+                    r.short_ms = t.short_press_ms;
+                if (!(ov & kOvLong))
+                    r.long_ms = t.long_press_ms;
+                if (!(ov & kOvDouble))
+                    r.double_ms = t.double_click_ms;
+                if (!(ov & kOvRepeatDelay))
+                    r.repeat_delay = t.repeat_delay_ms;
+                if (!(ov & kOvRepeatInterval))
+                    r.repeat_interval = t.repeat_interval_ms;
+            }
+        };
+
+        /**
+         * @brief Compact layout (same accessors as ButtonState<N, SoA>).
+         * @tparam N Number of buttons.
+         * @note Slots [0, UB_CONFIG_PROFILES) are the profiles; the next UB_COMPACT_CONFIGS
+         *       slots are shared by setConfig() configurations. setConfig() returns false
+         *       when none of those is free; the button then keeps its previous configuration.
+         */
+        template <size_t N, uint32_t TicksPerMs>
+        class ButtonState<N, Compact, TicksPerMs>
+        {
+            /// Stored timestamp/timing width: 16 bits of ms, or 32 bits for finer ticks.
+            using Stamp = typename UB::compat::conditional<(TicksPerMs > 1u), uint32_t, uint16_t>::type;
+
+            static constexpr uint8_t kFirstCustom = UB_CONFIG_PROFILES;                     ///< First setConfig() slot.
+            static constexpr uint8_t kSlots = UB_CONFIG_PROFILES + UB_COMPACT_CONFIGS;      ///< Total slots.
+
+        public:
+            const Behavior &behavior(size_t i) const noexcept { return slots_[cfg_[i]].beh; }
+
+            bool setConfig(size_t i, const ButtonPerConfig &c, const ButtonTimingConfig &t) noexcept
+            {
+                const uint8_t old = cfg_[i];
+                release_(old);
+
+                uint8_t slot = kNoSlot;
+                for (uint8_t k = kFirstCustom; k < kSlots && slot == kNoSlot; ++k)
+                {
+                    if (users_[k - kFirstCustom] != 0u && same_(slots_[k].per, c))
+                        slot = k;
+                }
+                for (uint8_t k = kFirstCustom; k < kSlots && slot == kNoSlot; ++k)
+                {
+                    if (users_[k - kFirstCustom] == 0u)
+                    {
+                        slots_[k].per = c;
+                        resolve_(k, t);
+                        slot = k;
+                    }
+                }
+                if (slot == kNoSlot)
+                {
+                    if (old >= kFirstCustom)
+                        ++users_[old - kFirstCustom];
+                    return false;
+                }
+
+                ++users_[slot - kFirstCustom];
+                cfg_[i] = slot;
+                return true;
+            }
+
+            void resolveAll(const ButtonTimingConfig &t) noexcept
+            {
+                for (uint8_t k = 0; k < kSlots; ++k)
+                    resolve_(k, t);
+            }
+
+            void setProfile(size_t i, uint8_t p, const ButtonTimingConfig &) noexcept
+            {
+                release_(cfg_[i]);
+                cfg_[i] = p;
+            }
+
+            void defineProfile(uint8_t p, const ButtonPerConfig &c, const ButtonTimingConfig &t) noexcept
+            {
+                slots_[p].per = c;
+                resolve_(p, t);
+            }
+
+            const ButtonPerConfig &profile(uint8_t p) const noexcept { return slots_[p].per; }
+            uint8_t profileOf(size_t i) const noexcept { return cfg_[i] < kFirstCustom ? cfg_[i] : kCustomProfile; }
+
+            uint32_t debounceMs(size_t i) const noexcept { return slots_[cfg_[i]].debounce_ms; }
+            uint32_t shortMs(size_t i) const noexcept { return slots_[cfg_[i]].short_ms; }
+            uint32_t longMs(size_t i) const noexcept { return slots_[cfg_[i]].long_ms; }
+            uint32_t doubleMs(size_t i) const noexcept { return slots_[cfg_[i]].double_ms; }
+            uint32_t repeatDelayMs(size_t i) const noexcept { return slots_[cfg_[i]].repeat_delay; }
+            uint32_t repeatIntervalMs(size_t i) const noexcept { return slots_[cfg_[i]].repeat_interval; }
+
+            uint32_t lastChange(size_t i, uint32_t ref) const noexcept { return expand_(last_change_[i], ref); }
+            void setLastChange(size_t i, uint32_t t) noexcept { last_change_[i] = static_cast<Stamp>(t); }
+            uint32_t pressStart(size_t i, uint32_t ref) const noexcept { return expand_(press_start_[i], ref); }
+            void setPressStart(size_t i, uint32_t t) noexcept { press_start_[i] = static_cast<Stamp>(t); }
+            uint32_t pendingSince(size_t i, uint32_t ref) const noexcept { return expand_(pending_since_[i], ref); }
+            void setPendingSince(size_t i, uint32_t t) noexcept { pending_since_[i] = static_cast<Stamp>(t); }
+            uint32_t duration(size_t i) const noexcept { return duration_[i]; }
+            void setDuration(size_t i, uint32_t d) noexcept { duration_[i] = clamp_(d); }
+            ButtonPressType &event(size_t i) noexcept { return event_[i]; }
+            ButtonPressType event(size_t i) const noexcept { return event_[i]; }
+            bool hasPress(size_t i) const noexcept { return UB::bits::test(has_press_, i); }
+            void setHasPress(size_t i, bool v) noexcept { UB::bits::assign(has_press_, i, v); }
+
+        private:
+            static constexpr uint8_t kNoSlot = 0xFF; ///< setConfig() search sentinel.
+
+            /**
+             * @brief One shared configuration with its resolved timing.
+             */
+            struct Slot
+            {
+                ButtonPerConfig per;
+                Behavior beh;
+                Stamp debounce_ms;
+                Stamp short_ms;
+                Stamp long_ms;
+                Stamp double_ms;
+                Stamp repeat_delay;
+                Stamp repeat_interval;
+            };
+
+            Stamp last_change_[N]{};
+            Stamp press_start_[N]{};
+            Stamp pending_since_[N]{};
+            Stamp duration_[N]{};
+            ButtonPressType event_[N]{};
+            uint8_t cfg_[N]{};                            ///< Slot index per button (profile 0 at start).
+            uint32_t has_press_[UB::bits::wordsFor(N)]{};
+            Slot slots_[kSlots]{};
+            uint8_t users_[UB_COMPACT_CONFIGS > 0 ? UB_COMPACT_CONFIGS : 1]{}; ///< Buttons per setConfig() slot.
+
+            /**
+             * @brief Drop one user of a setConfig() slot (profiles are never freed).
+             * @param k Slot index.
+             */
+            inline void release_(uint8_t k) noexcept
+            {
+                if (k >= kFirstCustom)
+                    --users_[k - kFirstCustom];
+            }
+
+            /**
+             * @brief Rebuild a 32-bit timestamp from its low bits.
+             * @param s Stored low bits.
+             * @param ref Reference time no earlier than the original timestamp.
+             */
+            static inline uint32_t expand_(Stamp s, uint32_t ref) noexcept
+            {
+                return ref - static_cast<Stamp>(static_cast<Stamp>(ref) - s);
+            }
+
+            static inline Stamp clamp_(uint32_t v) noexcept
+            {
+                return static_cast<Stamp>((TicksPerMs > 1u || v <= 0xFFFFu) ? v : 0xFFFFu);
+            }
+
+            /**
+             * @brief Whether two overrides share a slot (enabled/active_low are per button).
+             */
+            static inline bool same_(const ButtonPerConfig &a, const ButtonPerConfig &b) noexcept
+            {
+                return a.debounce_ms == b.debounce_ms && a.short_press_ms == b.short_press_ms &&
+                       a.long_press_ms == b.long_press_ms && a.double_click_ms == b.double_click_ms &&
+                       a.repeat_delay_ms == b.repeat_delay_ms && a.repeat_interval_ms == b.repeat_interval_ms &&
+                       a.long_on_hold == b.long_on_hold && a.early_short == b.early_short && a.no_double == b.no_double &&
+                       a.eager_samples == b.eager_samples &&
+                       a.latch_enabled == b.latch_enabled && a.latch_mode == b.latch_mode &&
+                       a.latch_on == b.latch_on && a.latch_initial == b.latch_initial;
+            }
+
+            inline void resolve_(uint8_t k, const ButtonTimingConfig &t) noexcept
+            {
+                const ButtonPerConfig &c = slots_[k].per;
+                slots_[k].beh = behaviorOf(c);
+                slots_[k].debounce_ms = clamp_(resolveMs(c.debounce_ms, t.debounce_ms));
+                slots_[k].short_ms = clamp_(resolveMs(c.short_press_ms, t.short_press_ms));
+                slots_[k].long_ms = clamp_(resolveMs(c.long_press_ms, t.long_press_ms));
+                slots_[k].double_ms = clamp_(resolveDoubleMs(c, t.double_click_ms));
+                slots_[k].repeat_delay = clamp_(resolveMs(c.repeat_delay_ms, t.repeat_delay_ms));
+                slots_[k].repeat_interval = clamp_(resolveMs(c.repeat_interval_ms, t.repeat_interval_ms));
+            }
+        };
+    } // namespace layout
+} // namespace UB
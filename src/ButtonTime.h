@@ -0,0 +1,105 @@
+/**
+ * MIT License
+ *
+ * @brief Time-base policies for ButtonHandler<N> (tick unit and default clock).
+ *
+ * @file ButtonTime.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-14
+ * @copyright Copyright © 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <ButtonCompatibility.h>
+#include <ButtonTypes.h>
+
+namespace UB
+{
+    namespace time
+    {
+        /**
+         * @brief Millisecond ticks from ::millis() (default).
+         *
+         * A time base only fixes the unit of every timestamp, duration and timing value
+         * a handler sees, and the clock used when no TimeFn is set. Handler arithmetic is
+         * modulo 2^32 and wrap-safe, so any free-running counter works once truncated to
+         * 32 bits (for example a 64-bit esp_timer_get_time()); intervals must stay below
+         * 2^31 ticks.
+         *
+         * A custom time base is any struct with the same two members.
+         */
+        struct Millis
+        {
+            static constexpr uint32_t kTicksPerMs = 1; ///< Ticks per millisecond.
+
+            /**
+             * @brief Current time in ticks (0 outside Arduino builds).
+             */
+            static inline uint32_t now() noexcept
+            {
+#if UB_HAS_ARDUINO
+                return millis();
+#else
+                return 0U;
+#endif
+            }
+        };
+
+        /**
+         * @brief Microsecond ticks from ::micros(), for scan rates above 1 kHz and sub-ms debounce.
+         * @note Wraps every 71.6 minutes, which the handler tolerates; single presses and
+         *       timing values must stay below about 35 minutes.
+         */
+        struct Micros
+        {
+            static constexpr uint32_t kTicksPerMs = 1000; ///< Ticks per millisecond.
+
+            /**
+             * @brief Current time in ticks (0 outside Arduino builds).
+             */
+            static inline uint32_t now() noexcept
+            {
+#if UB_HAS_ARDUINO
+                return micros();
+#else
+                return 0U;
+#endif
+            }
+        };
+
+        /**
+         * @brief Convert a millisecond timing configuration into ticks of time base @p T.
+         * @tparam T Time base (UB::time::Millis, UB::time::Micros, or a custom one).
+         * @param ms Timing in milliseconds.
+         * @return The same timing in ticks of @p T.
+         */
+        template <typename T>
+        constexpr ButtonTimingConfig fromMs(const ButtonTimingConfig &ms) noexcept
+        {
+            return ButtonTimingConfig(ms.debounce_ms * T::kTicksPerMs, ms.short_press_ms * T::kTicksPerMs,
+                                      ms.long_press_ms * T::kTicksPerMs, ms.double_click_ms * T::kTicksPerMs,
+                                      ms.repeat_delay_ms * T::kTicksPerMs, ms.repeat_interval_ms * T::kTicksPerMs,
+                                      ms.repeat_accel_ms * T::kTicksPerMs, ms.repeat_min_ms * T::kTicksPerMs);
+        }
+
+        /**
+         * @brief The library's default timing (30/200/1000/400 ms, ...) in ticks of @p T.
+         * @tparam T Time base.
+         */
+        template <typename T>
+        constexpr ButtonTimingConfig defaultTiming() noexcept
+        {
+            return fromMs<T>(ButtonTimingConfig{});
+        }
+    } // namespace time
+} // namespace UB
+
+/**
+ * @brief Default time base for ButtonHandler<N> (UB::time::Millis or UB::time::Micros).
+ * @note Applies to every handler built by the Easy Header factories; ButtonHandler<N, Layout, Time>
+ *       can also pick one directly.
+ */
+#ifndef UB_TIME_BASE
+#define UB_TIME_BASE UB::time::Millis
+#endif
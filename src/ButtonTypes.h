@@ -21,9 +21,58 @@ enum class ButtonPressType : uint8_t
     None,  ///< No event.
     Short, ///< Short press event.
     Long,  ///< Long press event.
-    Double ///< Two short presses within a configured gap; Short is delayed until that gap expires.
+    Double, ///< Two short presses within a configured gap; Short is delayed until that gap expires.
+    Repeat, ///< Button still held: fires after repeat_delay_ms, then every repeat interval (see ButtonTimingConfig).
+    Chord   ///< Registered button combination held for its hold time (queue only; index = chord id).
 };
 
+namespace UB
+{
+    /**
+     * @brief nextDeadline() result meaning "nothing is time-dependent; wait for input".
+     */
+    constexpr uint32_t kNoDeadline = 0xFFFFFFFFUL;
+
+    /**
+     * @brief Fold one due time into a running "ms until the next deadline" minimum.
+     * @param wait Running minimum (start at UB::kNoDeadline).
+     * @param now Current time (ms).
+     * @param due Absolute due time (ms); overdue (wrap-aware) counts as 0.
+     */
+    inline void foldDeadline(uint32_t &wait, uint32_t now, uint32_t due) noexcept
+    {
+        const uint32_t left = (static_cast<int32_t>(due - now) > 0) ? (due - now) : 0U;
+        if (left < wait)
+            wait = left;
+    }
+
+    /**
+     * @brief Convert a folded wait back to an absolute deadline.
+     * @param now Current time (ms).
+     * @param wait Result of foldDeadline() calls.
+     * @return now + wait, or UB::kNoDeadline if nothing was folded.
+     * @note A real deadline that lands on the sentinel value is reported 1 ms early.
+     */
+    inline uint32_t deadlineAt(uint32_t now, uint32_t wait) noexcept
+    {
+        if (wait == kNoDeadline)
+            return kNoDeadline;
+        const uint32_t at = now + wait;
+        return (at == kNoDeadline) ? at - 1U : at;
+    }
+
+    /**
+     * @brief profileOf() result for a button configured with its own setPerConfig() overrides.
+     */
+    constexpr uint8_t kCustomProfile = 0xFF;
+
+    /**
+     * @brief Buckets in the UB_STATS press-duration histogram.
+     * @note Bucket k counts presses shorter than (32 << k) ms; the last bucket counts the rest (>= 2048 ms).
+     */
+    constexpr uint8_t kPressBuckets = 8;
+} // namespace UB
+
 /**
  * @brief Latching behavior applied when a configured trigger event occurs.
  */
@@ -44,6 +93,54 @@ enum class LatchTrigger : uint8_t
     Double ///< Trigger latching on ButtonPressType::Double.
 };
 
+/**
+ * @brief One finalized press event as delivered by ButtonHandler<N>::drainEvents().
+ */
+struct ButtonEvent
+{
+    uint32_t timestamp;   ///< Time (ms) the event was finalized (release, or double-click window expiry for Short).
+    uint32_t duration;    ///< Duration (ms) of the press that produced the event.
+    uint8_t index;        ///< Logical button index (chord id for ButtonPressType::Chord).
+    ButtonPressType type; ///< Short, Long, Double, Repeat, or Chord (never None).
+};
+
+/**
+ * @brief Running minimum, maximum and average of one measured quantity (UB_STATS).
+ * @note Values are only meaningful once count > 0. When total would overflow, total and
+ *       count are halved together, so avg() keeps tracking recent samples.
+ */
+struct ButtonStatSpan
+{
+    uint32_t count{0};     ///< Samples folded into total.
+    uint32_t min_value{0}; ///< Smallest sample seen.
+    uint32_t max_value{0}; ///< Largest sample seen.
+    uint32_t total{0};     ///< Sum of the counted samples.
+
+    /**
+     * @brief Average sample (0 before the first one).
+     */
+    uint32_t avg() const noexcept { return count ? total / count : 0U; }
+
+    /**
+     * @brief Fold one sample in.
+     * @param v Sample value.
+     */
+    void add(uint32_t v) noexcept
+    {
+        if (count == 0u || v < min_value)
+            min_value = v;
+        if (v > max_value)
+            max_value = v;
+        while (count != 0u && (total > 0xFFFFFFFFUL - v || count == 0xFFFFFFFFUL))
+        {
+            count >>= 1;
+            total = count ? (total >> 1) : 0U;
+        }
+        total += v;
+        ++count;
+    }
+};
+
 /**
  * @brief Configuration for debounce and press-duration timings.
  */
@@ -54,23 +151,37 @@ struct ButtonTimingConfig
     uint32_t long_press_ms;   ///< Minimum time for a long press.
     uint32_t double_click_ms; ///< Max gap between two short presses to count as a double; delays Short emission.
 
+    // Hold-repeat (ButtonHandler<N> only).
+    uint32_t repeat_delay_ms;    ///< Hold time before the first Repeat; 0 = no repeat unless a button overrides it.
+    uint32_t repeat_interval_ms; ///< Gap between the first and second Repeat.
+    uint32_t repeat_accel_ms;    ///< Each further gap shrinks by this much (0 = fixed rate).
+    uint32_t repeat_min_ms;      ///< Shortest gap acceleration can reach.
+
     constexpr ButtonTimingConfig(uint32_t debounce = 30,
                                  uint32_t short_press = 200,
                                  uint32_t long_press = 1000,
-                                 uint32_t double_click = 400)
-        : debounce_ms(debounce), short_press_ms(short_press), long_press_ms(long_press), double_click_ms(double_click) {}
+                                 uint32_t double_click = 400,
+                                 uint32_t repeat_delay = 0,
+                                 uint32_t repeat_interval = 100,
+                                 uint32_t repeat_accel = 0,
+                                 uint32_t repeat_min = 25)
+        : debounce_ms(debounce), short_press_ms(short_press), long_press_ms(long_press), double_click_ms(double_click),
+          repeat_delay_ms(repeat_delay), repeat_interval_ms(repeat_interval), repeat_accel_ms(repeat_accel),
+          repeat_min_ms(repeat_min) {}
 };
 
 /**
  * @brief Optional per-button overrides (library feature, not required by the interface).
  * Zero values fall back to global timings; active_low=true means LOW=pressed.
+ * @note Timing fields are in the handler's ticks (milliseconds unless the handler uses a finer
+ *       time base) and are 32-bit, so UB::time::Micros overrides reach as far as global timings.
  */
 struct ButtonPerConfig
 {
-    uint16_t debounce_ms{0};     ///< 0 => use global timing_.debounce_ms.
-    uint16_t short_press_ms{0};  ///< 0 => use global timing_.short_press_ms.
-    uint16_t long_press_ms{0};   ///< 0 => use global timing_.long_press_ms.
-    uint16_t double_click_ms{0}; ///< 0 => use global timing_.double_click_ms; non-zero delays Short by this window.
+    uint32_t debounce_ms{0};     ///< 0 => use global timing_.debounce_ms.
+    uint32_t short_press_ms{0};  ///< 0 => use global timing_.short_press_ms.
+    uint32_t long_press_ms{0};   ///< 0 => use global timing_.long_press_ms.
+    uint32_t double_click_ms{0}; ///< 0 => use global timing_.double_click_ms; non-zero delays Short by this window.
     bool active_low{true};       ///< true = LOW means pressed (default pull-up wiring).
     bool enabled{true};          ///< false = ignore this button in update().
 
@@ -79,4 +190,12 @@ struct ButtonPerConfig
     LatchMode latch_mode{LatchMode::Toggle};    ///< Toggle / Set / Reset behavior when triggered.
     LatchTrigger latch_on{LatchTrigger::Short}; ///< Which press event drives latching for this button.
     bool latch_initial{false};                  ///< Initial latched state applied on construction and reset().
+
+    // Hold repeat and classification (appended so positional initializers keep their meaning).
+    uint32_t repeat_delay_ms{0};    ///< 0 => use global timing_.repeat_delay_ms (0 there = no repeat).
+    uint32_t repeat_interval_ms{0}; ///< 0 => use global timing_.repeat_interval_ms.
+    bool long_on_hold{false};       ///< true = emit Long when the hold reaches long_press_ms, not on release.
+    bool early_short{false};        ///< true = emit Short on release without waiting; a second tap adds a Double.
+    bool no_double{false};          ///< true = no Double: Short fires on release and double_click_ms is ignored.
+    uint8_t eager_samples{0};       ///< 0 = commit after debounce_ms of stable input; n >= 1 = commit after n differing scans, then lock out for debounce_ms (timed engine).
 };
@@ -45,14 +45,14 @@ public:
     /**
      * @brief Get and consume press event for a button.
      * @param buttonId Index of button.
-     * @return ButtonPressType Event type: Short, Long, Double, or None.
+     * @return ButtonPressType Event type: Short, Long, Double, Repeat, or None.
      */
     virtual ButtonPressType getPressType(uint8_t buttonId) noexcept = 0;
 
     /**
      * @brief Peek at the pending press event for a button without consuming it.
      * @param buttonId Index of button.
-     * @return ButtonPressType Event type: Short, Long, Double, or None.
+     * @return ButtonPressType Event type: Short, Long, Double, Repeat, or None.
      */
     [[nodiscard]] virtual ButtonPressType peekPressType(uint8_t /*buttonId*/) const noexcept { return ButtonPressType::None; }
 
@@ -66,6 +66,15 @@ public:
      */
     virtual void reset() noexcept { /* no-op by default */ }
 
+    /**
+     * @brief Earliest time (ms) at which update() has timing work to do.
+     * @param now Current time (ms).
+     * @return Absolute timestamp (now if already due), or UB::kNoDeadline when idle.
+     * @note Raw input changes are not predictable; wake early on an edge notification.
+     *       The default returns @p now, i.e. "keep calling update() at your usual cadence".
+     */
+    [[nodiscard]] virtual uint32_t nextDeadline(uint32_t now) const noexcept { return now; }
+
     /**
      * @brief Number of logical buttons managed by this handler.
      * @return Count of buttons (0–255).
@@ -74,17 +83,59 @@ public:
 
     /**
      * @brief Build a 32-bit pressed mask (bit i == 1 iff button i is pressed).
-     * @note Only buttons 0..31 are represented. Use snapshot()/forEach() for wider handlers.
+     * @note Only buttons 0..31 are represented. Use pressedWords() for wider handlers.
      */
     [[nodiscard]] virtual uint32_t pressedMask() const noexcept
     {
         uint32_t m = 0;
         for (uint8_t i = 0; i < size() && i < 32; ++i)
             if (isPressed(i))
-                m |= (1u << i);
+                m |= (static_cast<uint32_t>(1u) << i);
+        return m;
+    }
+
+    /**
+     * @brief Write the debounced state as packed words (bit i of out[i / 32] == pressed).
+     * @param out Destination word array.
+     * @param nwords Words available in @p out; bits beyond size() are written as 0.
+     * @note The default builds the words from isPressed(); ButtonHandler<N> copies its packed state.
+     */
+    virtual void pressedWords(uint32_t *out, size_t nwords) const noexcept
+    {
+        for (size_t w = 0; w < nwords; ++w)
+            out[w] = 0U;
+        for (uint8_t i = 0; i < size() && static_cast<size_t>(i >> 5) < nwords; ++i)
+            if (isPressed(i))
+                out[i >> 5] |= (static_cast<uint32_t>(1u) << (i & 31u));
+    }
+
+    /**
+     * @brief Build a 32-bit mask of buttons with an unread event (bit i == peekPressType(i) != None).
+     * @note Only buttons 0..31 are represented. Use eventWords() for wider handlers.
+     */
+    [[nodiscard]] virtual uint32_t eventMask() const noexcept
+    {
+        uint32_t m = 0;
+        for (uint8_t i = 0; i < size() && i < 32; ++i)
+            if (peekPressType(i) != ButtonPressType::None)
+                m |= (static_cast<uint32_t>(1u) << i);
         return m;
     }
 
+    /**
+     * @brief Write the unread-event flags as packed words (bit i == peekPressType(i) != None).
+     * @param out Destination word array.
+     * @param nwords Words available in @p out; bits beyond size() are written as 0.
+     */
+    virtual void eventWords(uint32_t *out, size_t nwords) const noexcept
+    {
+        for (size_t w = 0; w < nwords; ++w)
+            out[w] = 0U;
+        for (uint8_t i = 0; i < size() && static_cast<size_t>(i >> 5) < nwords; ++i)
+            if (peekPressType(i) != ButtonPressType::None)
+                out[i >> 5] |= (static_cast<uint32_t>(1u) << (i & 31u));
+    }
+
     /**
      * @brief Write the current debounced state into a compat bitset (bit i == pressed).
      * @tparam N Size of the destination bitset.
@@ -214,24 +265,83 @@ public:
      */
     virtual void clearLatchedMask(uint32_t /*mask*/) noexcept {}
 
+    /**
+     * @brief Clear a subset of latched states using a packed word mask.
+     * @param mask Word array (bit i of mask[i / 32] = button i).
+     * @param nwords Number of words in @p mask.
+     */
+    virtual void clearLatchedWords(const uint32_t *mask, size_t nwords) noexcept
+    {
+        for (uint8_t i = 0; i < size() && static_cast<size_t>(i >> 5) < nwords; ++i)
+            if ((mask[i >> 5] >> (i & 31u)) & 1u)
+                setLatched(i, false);
+    }
+
+    /**
+     * @brief Force the latched state of a subset of buttons using a bitmask.
+     * @param mask Bitmask of button indices to change (buttons 0..31 only).
+     * @param on Desired latched state.
+     */
+    virtual void setLatchedMask(uint32_t mask, bool on) noexcept { setLatchedWords(&mask, 1, on); }
+
+    /**
+     * @brief Force the latched state of a subset of buttons using a packed word mask.
+     * @param mask Word array (bit i of mask[i / 32] = button i).
+     * @param nwords Number of words in @p mask.
+     * @param on Desired latched state.
+     */
+    virtual void setLatchedWords(const uint32_t *mask, size_t nwords, bool on) noexcept
+    {
+        for (uint8_t i = 0; i < size() && static_cast<size_t>(i >> 5) < nwords; ++i)
+            if ((mask[i >> 5] >> (i & 31u)) & 1u)
+                setLatched(i, on);
+    }
+
     /**
      * @brief Build a 32-bit latched mask.
      * @return Bitmask where bit i is set when button i is latched ON (up to 32 buttons).
-     * @note Only buttons 0..31 are represented. Use isLatched()/forEach-style loops for wider handlers.
+     * @note Only buttons 0..31 are represented. Use latchedWords() for wider handlers.
      */
     [[nodiscard]] virtual uint32_t latchedMask() const noexcept
     {
         uint32_t m = 0;
         for (uint8_t i = 0; i < size() && i < 32; ++i)
             if (isLatched(i))
-                m |= (1u << i);
+                m |= (static_cast<uint32_t>(1u) << i);
         return m;
     }
 
+    /**
+     * @brief Write the latched state as packed words (bit i of out[i / 32] == latched ON).
+     * @param out Destination word array.
+     * @param nwords Words available in @p out; bits beyond size() are written as 0.
+     */
+    virtual void latchedWords(uint32_t *out, size_t nwords) const noexcept
+    {
+        for (size_t w = 0; w < nwords; ++w)
+            out[w] = 0U;
+        for (uint8_t i = 0; i < size() && static_cast<size_t>(i >> 5) < nwords; ++i)
+            if (isLatched(i))
+                out[i >> 5] |= (static_cast<uint32_t>(1u) << (i & 31u));
+    }
+
     /**
      * @brief Edge flag for latching: true if latched state changed since the last clear.
      * @param buttonId Index of button.
      * @return True if the latched state changed since the previous call.
      */
     virtual bool getAndClearLatchedChanged(uint8_t /*buttonId*/) noexcept { return false; }
+
+protected:
+    /**
+     * @brief Fold one due time into a running "ms until the next deadline" minimum.
+     * @see UB::foldDeadline()
+     */
+    static void foldDeadline_(uint32_t &wait, uint32_t now, uint32_t due) noexcept { UB::foldDeadline(wait, now, due); }
+
+    /**
+     * @brief Convert a folded wait back to an absolute deadline.
+     * @see UB::deadlineAt()
+     */
+    static uint32_t deadlineAt_(uint32_t now, uint32_t wait) noexcept { return UB::deadlineAt(now, wait); }
 };
@@ -0,0 +1,253 @@
+/**
+ * MIT License
+ *
+ * @brief Key-matrix scanner that plugs into the bulk bank-reader path.
+ *
+ * @file MatrixReader.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-14
+ * @copyright Copyright © 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <ButtonCompatibility.h>
+#include <ButtonBits.h>
+
+/**
+ * @brief Row-driven key-matrix scanner producing a packed raw bitmap.
+ *
+ * Each scan activates one row at a time, waits the settle time, and reads every
+ * column as one port word. Key (row, col) maps to logical button row * Cols + col.
+ * Use readBank() as a ButtonHandler<N> ReadBankFn with this object as ctx.
+ *
+ * Two hardware paths:
+ *  - Callbacks: selectRow(ctx, row, active) drives a row; readCols(ctx) returns a
+ *    word with bit c set when column c sees the active row (key closed). One port
+ *    read per row.
+ *  - Arduino pins: rows are driven LOW when active (HIGH otherwise), columns use
+ *    INPUT_PULLUP and read LOW when closed. Call begin() once to configure pins.
+ *
+ * @tparam Rows Number of driven rows (1..32).
+ * @tparam Cols Number of sensed columns (1..32).
+ */
+template <uint8_t Rows, uint8_t Cols>
+class MatrixReader
+{
+    static_assert(Rows > 0 && Rows <= 32, "MatrixReader: Rows must be in 1..32.");
+    static_assert(Cols > 0 && Cols <= 32, "MatrixReader: Cols must be in 1..32.");
+    static_assert(static_cast<size_t>(Rows) * Cols <= 255, "MatrixReader: Rows * Cols must be <= 255 to fit ButtonHandler<N>.");
+
+public:
+    // ---- Types ---- //
+
+    /**
+     * @brief Drive one row active or idle.
+     * @param ctx Opaque context.
+     * @param row Row index [0..Rows-1].
+     * @param active true => select the row for reading; false => release it.
+     */
+    using SelectRowFn = void (*)(void *ctx, uint8_t row, bool active);
+
+    /**
+     * @brief Read all columns at once.
+     * @param ctx Opaque context.
+     * @return Bit c set when column c reads "closed" for the selected row.
+     */
+    using ReadColsFn = uint32_t (*)(void *ctx);
+
+    static constexpr size_t kKeys = static_cast<size_t>(Rows) * Cols; ///< Logical keys produced per scan.
+    static constexpr size_t kWords = UB::bits::wordsFor(kKeys);        ///< Bitmap words needed for kKeys.
+
+    // ---- Constructors ---- //
+
+    /**
+     * @brief Construct with row-select and column-read callbacks.
+     * @param selectRow Row driver (see SelectRowFn).
+     * @param readCols Column port reader (see ReadColsFn).
+     * @param ctx Opaque pointer passed back to both callbacks.
+     * @param settleUs Delay (µs) between selecting a row and reading columns (Arduino builds only).
+     */
+    MatrixReader(SelectRowFn selectRow, ReadColsFn readCols, void *ctx, uint16_t settleUs = 0) noexcept
+        : select_fn_(selectRow), read_fn_(readCols), ctx_(ctx), settle_us_(settleUs) {}
+
+#if UB_HAS_ARDUINO
+    /**
+     * @brief Construct with native Arduino row/column pins.
+     * @param rowPins Row output pins (driven LOW when active).
+     * @param colPins Column input pins (INPUT_PULLUP, LOW when closed).
+     * @param settleUs Delay (µs) between selecting a row and reading columns.
+     */
+    MatrixReader(const uint8_t (&rowPins)[Rows], const uint8_t (&colPins)[Cols], uint16_t settleUs = 5) noexcept
+        : settle_us_(settleUs)
+    {
+        for (uint8_t r = 0; r < Rows; ++r)
+            row_pins_[r] = rowPins[r];
+        for (uint8_t c = 0; c < Cols; ++c)
+            col_pins_[c] = colPins[c];
+    }
+
+    /**
+     * @brief Configure native pins (no-op for the callback path).
+     */
+    void begin() noexcept
+    {
+        if (select_fn_)
+            return;
+        for (uint8_t r = 0; r < Rows; ++r)
+        {
+            pinMode(row_pins_[r], OUTPUT);
+            digitalWrite(row_pins_[r], HIGH);
+        }
+        for (uint8_t c = 0; c < Cols; ++c)
+            pinMode(col_pins_[c], INPUT_PULLUP);
+    }
+#endif
+
+    // ---- Configuration ---- //
+
+    /**
+     * @brief Enable ghost-key blocking.
+     * @param on true => rows that form an ambiguous rectangle keep their previous value.
+     * @note Without per-key diodes, three closed corners of a rectangle make the fourth
+     *       read closed too. Any two rows sharing two or more closed columns are ambiguous.
+     */
+    void setGhostDetection(bool on) noexcept { ghost_detect_ = on; }
+
+    /**
+     * @brief Set the row settle delay.
+     * @param us Microseconds between selecting a row and reading columns (Arduino builds only).
+     */
+    void setSettleUs(uint16_t us) noexcept { settle_us_ = us; }
+
+    // ---- Scanning ---- //
+
+    /**
+     * @brief Scan every row and OR the closed keys into a packed bitmap.
+     * @param words Destination bitmap (bit k of words[k / 32] = key k closed); expected zeroed.
+     * @param nwords Words available; keys past nwords * 32 are dropped.
+     */
+    void scan(uint32_t *words, size_t nwords) noexcept
+    {
+        const uint32_t colMask = (Cols == 32) ? ~static_cast<uint32_t>(0U)
+                                              : ((static_cast<uint32_t>(1u) << Cols) - 1u);
+        uint32_t rows[Rows];
+        for (uint8_t r = 0; r < Rows; ++r)
+            rows[r] = readRow_(r) & colMask;
+
+        ghosted_ = false;
+        if (ghost_detect_)
+        {
+            bool blocked[Rows] = {};
+            for (uint8_t a = 0; a < Rows; ++a)
+            {
+                for (uint8_t b = static_cast<uint8_t>(a + 1u); b < Rows; ++b)
+                {
+                    const uint32_t shared = rows[a] & rows[b];
+                    if ((shared & (shared - 1u)) != 0u) // two or more shared columns
+                        blocked[a] = blocked[b] = true;
+                }
+            }
+            for (uint8_t r = 0; r < Rows; ++r)
+            {
+                if (blocked[r])
+                {
+                    rows[r] = prev_rows_[r];
+                    ghosted_ = true;
+                }
+            }
+        }
+
+        for (uint8_t r = 0; r < Rows; ++r)
+        {
+            prev_rows_[r] = rows[r];
+            orRow_(words, nwords, static_cast<size_t>(r) * Cols, rows[r]);
+        }
+    }
+
+    /**
+     * @brief ReadBankFn thunk for ButtonHandler<N>.
+     * @param ctx Pointer to this MatrixReader.
+     * @param words Zeroed bitmap supplied by the handler.
+     * @param nwords Number of words in @p words.
+     */
+    static void readBank(void *ctx, uint32_t *words, size_t nwords) noexcept
+    {
+        static_cast<MatrixReader *>(ctx)->scan(words, nwords);
+    }
+
+    /**
+     * @brief Whether the most recent scan blocked ambiguous (ghosted) rows.
+     */
+    [[nodiscard]] bool ghosted() const noexcept { return ghosted_; }
+
+private:
+    SelectRowFn select_fn_{nullptr}; ///< Row driver (callback path).
+    ReadColsFn read_fn_{nullptr};    ///< Column port reader (callback path).
+    void *ctx_{nullptr};             ///< Opaque context for the callbacks.
+    uint8_t row_pins_[Rows]{};       ///< Native row pins.
+    uint8_t col_pins_[Cols]{};       ///< Native column pins.
+    uint32_t prev_rows_[Rows]{};     ///< Last accepted column word per row (ghost blocking).
+    uint16_t settle_us_{0};          ///< Row settle delay (µs).
+    bool ghost_detect_{false};       ///< Block ambiguous rows.
+    bool ghosted_{false};            ///< Last scan blocked at least one row.
+
+    /**
+     * @brief Select one row, read all columns, release the row.
+     * @param r Row index.
+     * @return Column word (bit c = column c closed).
+     */
+    inline uint32_t readRow_(uint8_t r) noexcept
+    {
+        if (select_fn_)
+        {
+            select_fn_(ctx_, r, true);
+            settle_();
+            const uint32_t cols = read_fn_ ? read_fn_(ctx_) : 0U;
+            select_fn_(ctx_, r, false);
+            return cols;
+        }
+#if UB_HAS_ARDUINO
+        digitalWrite(row_pins_[r], LOW);
+        settle_();
+        uint32_t cols = 0U;
+        for (uint8_t c = 0; c < Cols; ++c)
+        {
+            if (digitalRead(col_pins_[c]) == LOW)
+                cols |= (static_cast<uint32_t>(1u) << c);
+        }
+        digitalWrite(row_pins_[r], HIGH);
+        return cols;
+#else
+        return 0U;
+#endif
+    }
+
+    /**
+     * @brief Wait for row lines to settle.
+     */
+    inline void settle_() const noexcept
+    {
+#if UB_HAS_ARDUINO
+        if (settle_us_)
+            delayMicroseconds(settle_us_);
+#endif
+    }
+
+    /**
+     * @brief OR a Cols-bit field into the bitmap at bit offset @p off.
+     * @param words Bitmap.
+     * @param nwords Words available.
+     * @param off First key index of the row.
+     * @param cols Column word for the row.
+     */
+    static inline void orRow_(uint32_t *words, size_t nwords, size_t off, uint32_t cols) noexcept
+    {
+        const size_t w = off >> 5;
+        const uint32_t s = static_cast<uint32_t>(off & 31u);
+        if (w < nwords)
+            words[w] |= (cols << s);
+        if (s != 0u && s + Cols > 32u && (w + 1u) < nwords)
+            words[w + 1u] |= (cols >> (32u - s));
+    }
+};
@@ -0,0 +1,526 @@
+/**
+ * MIT License
+ *
+ * @brief Compile-time specialised multi-button handler (fixed timings and polarity).
+ *
+ * @file StaticButtonHandler.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-14
+ * @copyright Copyright © 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <ButtonCompatibility.h>
+#include <ButtonBits.h>
+#include <ButtonTypes.h>
+#include <IButtonHandler.h>
+
+/**
+ * @brief Compile-time timing set for StaticButtonHandler.
+ * @tparam Debounce Minimum stable time to confirm a press/release (ms).
+ * @tparam ShortPress Minimum time for a short press (ms).
+ * @tparam LongPress Minimum time for a long press (ms).
+ * @tparam DoubleClick Max gap between two short presses to count as a double (ms).
+ */
+template <uint32_t Debounce = 30, uint32_t ShortPress = 200, uint32_t LongPress = 1000, uint32_t DoubleClick = 400>
+struct StaticTiming
+{
+    static constexpr uint32_t debounce_ms = Debounce;        ///< Debounce window.
+    static constexpr uint32_t short_press_ms = ShortPress;   ///< Short-press threshold.
+    static constexpr uint32_t long_press_ms = LongPress;     ///< Long-press threshold.
+    static constexpr uint32_t double_click_ms = DoubleClick; ///< Double-click window.
+};
+
+/**
+ * @brief Compile-time polarity policy for StaticButtonHandler.
+ * @tparam ActiveLow true => LOW (reader returns true) means pressed; false inverts every reading.
+ */
+template <bool ActiveLow = true>
+struct StaticPolicy
+{
+    static constexpr bool active_low = ActiveLow; ///< Polarity applied to every button.
+};
+
+/**
+ * @brief Multi-button handler with timings and polarity fixed at compile time.
+ *
+ * Same debounce and Short/Long/Double classification as ButtonHandler<N>, but
+ * without per-button runtime configuration: there is no ButtonPerConfig storage,
+ * no enable/polarity masks, and no latching. Timing thresholds are constexpr, so
+ * comparisons fold to immediates. Choose this for fixed builds on small MCUs;
+ * use ButtonHandler<N> when buttons need runtime overrides or latching.
+ *
+ * @tparam N Number of logical buttons handled by this instance.
+ * @tparam Timing StaticTiming<...> (or any type exposing the same constexpr members).
+ * @tparam Policy StaticPolicy<...> (or any type exposing constexpr bool active_low).
+ */
+template <size_t N, typename Timing = StaticTiming<>, typename Policy = StaticPolicy<>>
+class StaticButtonHandler : public IButtonHandler
+{
+    static_assert(N > 0, "StaticButtonHandler<N>: N must be greater than 0.");
+    static_assert(N <= 255, "StaticButtonHandler<N>: N must be <= 255 to fit the uint8_t API.");
+    static_assert(Timing::short_press_ms <= Timing::long_press_ms,
+                  "StaticButtonHandler: short_press_ms must not exceed long_press_ms.");
+
+public:
+    // ---- Types ---- //
+
+    using ReadPinFn = bool (*)(uint8_t);                                ///< Per-pin reader (see ButtonHandler).
+    using ReadFn = bool (*)(void *ctx, uint8_t id);                     ///< Context-aware reader (see ButtonHandler).
+    using ReadBankFn = void (*)(void *ctx, uint32_t *words, size_t nw); ///< Bulk bank reader (see ButtonHandler).
+    using TimeFn = uint32_t (*)();                                      ///< Millisecond time source.
+
+    /**
+     * @brief Number of 32-bit words in a packed per-button bitmap for this handler.
+     */
+    static constexpr size_t kWords = UB::bits::wordsFor(N);
+
+    // ---- Construction ---- //
+
+    /**
+     * @brief Construct using native Arduino GPIO reads.
+     * @param buttonPins Reference to an array of length N with pin IDs.
+     * @param skipPinInit If true, GPIO mode is not configured here.
+     * @param timeFn Optional time source (ms). If nullptr, uses millis() on Arduino.
+     */
+    explicit StaticButtonHandler(const uint8_t (&buttonPins)[N],
+                                 bool skipPinInit = false,
+                                 TimeFn timeFn = nullptr) noexcept
+        : time_fn_{timeFn}
+    {
+        init_(buttonPins, skipPinInit);
+    }
+
+    /**
+     * @brief Construct with a per-pin fast reader function.
+     * @param buttonPins Reference to an array of length N with pin IDs.
+     * @param readPin Fast reader: bool(uint8_t id) returns pressed.
+     * @param timeFn Optional time source (ms). If nullptr, uses millis() on Arduino.
+     */
+    StaticButtonHandler(const uint8_t (&buttonPins)[N], ReadPinFn readPin, TimeFn timeFn = nullptr) noexcept
+        : read_pin_fn_{readPin}, time_fn_{timeFn}
+    {
+        init_(buttonPins, true);
+    }
+
+    /**
+     * @brief Construct with a context-aware reader callback.
+     * @param buttonPins Reference to an array of length N with pin IDs.
+     * @param readCb Reader: bool(void* ctx, uint8_t id) returns pressed.
+     * @param ctx Pointer passed to readCb on each call.
+     * @param timeFn Optional time source (ms). If nullptr, uses millis() on Arduino.
+     */
+    StaticButtonHandler(const uint8_t (&buttonPins)[N], ReadFn readCb, void *ctx, TimeFn timeFn = nullptr) noexcept
+        : read_fn_{readCb}, read_ctx_{ctx}, time_fn_{timeFn}
+    {
+        init_(buttonPins, true);
+    }
+
+    /**
+     * @brief Construct with a bulk bank reader (one call per update()).
+     * @param buttonPins Reference to an array of length N with pin IDs.
+     * @param readBank Reader: fills the zeroed pressed bitmap (bit i = logical button i).
+     * @param ctx Pointer passed to readBank on each call.
+     * @param timeFn Optional time source (ms). If nullptr, uses millis() on Arduino.
+     */
+    StaticButtonHandler(const uint8_t (&buttonPins)[N], ReadBankFn readBank, void *ctx, TimeFn timeFn = nullptr) noexcept
+        : read_bank_fn_{readBank}, read_ctx_{ctx}, time_fn_{timeFn}
+    {
+        init_(buttonPins, true);
+    }
+
+    /**
+     * @brief Inject a time source (milliseconds).
+     * @param fn Function pointer: uint32_t() returning current time in ms.
+     */
+    void setTimeFn(TimeFn fn) noexcept { time_fn_ = fn; }
+
+    // ---- IButtonHandler overrides ---- //
+
+    /**
+     * @brief Number of logical buttons handled by this instance.
+     * @return Compile-time constant (N) as uint8_t.
+     */
+    [[nodiscard]] uint8_t size() const noexcept override { return static_cast<uint8_t>(N); }
+
+    /**
+     * @brief Compile-time number of logical buttons.
+     * @return N as uint8_t.
+     */
+    [[nodiscard]] static constexpr uint8_t sizeStatic() noexcept { return static_cast<uint8_t>(N); }
+
+    /**
+     * @brief Iterate all debounced button states.
+     * @tparam F Callable with signature f(uint8_t index, bool pressed).
+     * @param f Callback invoked once per button.
+     */
+    template <typename F>
+    void forEach(F &&f) const noexcept
+    {
+        for (size_t i = 0; i < N; ++i)
+            f(static_cast<uint8_t>(i), UB::bits::test(state_, i));
+    }
+
+    /**
+     * @brief Build a 32-bit pressed mask (bit i == 1 iff button i is pressed).
+     * @note Only buttons 0..31 are represented. Use pressedWords() for wider handlers.
+     */
+    [[nodiscard]] uint32_t pressedMask() const noexcept override { return state_[0]; }
+
+    /**
+     * @brief Copy the debounced pressed state as packed words.
+     * @param out Destination (bit i of out[i / 32] = button i pressed).
+     * @param nwords Words available in @p out; words beyond kWords are zeroed.
+     */
+    void pressedWords(uint32_t *out, size_t nwords) const noexcept override
+    {
+        for (size_t w = 0; w < nwords; ++w)
+            out[w] = (w < kWords) ? state_[w] : 0U;
+    }
+
+    /**
+     * @brief Scan and process button states using the configured time source.
+     */
+    void update() noexcept override { update(time_now_()); }
+
+    /**
+     * @brief Scan and process button states using a provided timestamp.
+     * @param now Millisecond timestamp to use.
+     */
+    void update(uint32_t now) noexcept override
+    {
+        uint32_t raw[kWords];
+        sample_(raw);
+
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            // Active set: raw edge, open debounce window, held press, or pending Short.
+            uint32_t m = raw[w] | raw_[w] | state_[w] | pending_[w];
+            while (m)
+            {
+                const size_t i = (w << 5) + UB::bits::lowestSet(m);
+                m &= m - 1u;
+                step_(i, UB::bits::test(raw, i), now);
+            }
+        }
+    }
+
+    /**
+     * @brief Get debounced state of a button.
+     * @param buttonId Index of button.
+     * @return true if the button is currently pressed (committed/debounced).
+     */
+    [[nodiscard]] bool isPressed(uint8_t buttonId) const noexcept override
+    {
+        return (buttonId < N) ? UB::bits::test(state_, buttonId) : false;
+    }
+
+    /**
+     * @brief Get and consume the press event type for a button.
+     * @param buttonId Index of button.
+     * @return ButtonPressType::Short, ::Long, ::Double, or ::None if no new event.
+     */
+    ButtonPressType getPressType(uint8_t buttonId) noexcept override
+    {
+        if (buttonId >= N)
+            return ButtonPressType::None;
+        const ButtonPressType e = event_[buttonId];
+        event_[buttonId] = ButtonPressType::None; // consume
+        return e;
+    }
+
+    /**
+     * @brief Peek at the pending press event without consuming it.
+     * @param buttonId Index of button.
+     * @return Pending ButtonPressType, or ::None.
+     */
+    [[nodiscard]] ButtonPressType peekPressType(uint8_t buttonId) const noexcept override
+    {
+        return (buttonId < N) ? event_[buttonId] : ButtonPressType::None;
+    }
+
+    /**
+     * @brief Exact duration (ms) of the most recent completed press (on release).
+     * @param buttonId Index of button.
+     * @return Milliseconds of the most recent completed press, or 0.
+     */
+    [[nodiscard]] uint32_t getLastPressDuration(uint8_t buttonId) const noexcept override
+    {
+        return (buttonId < N) ? last_duration_[buttonId] : 0U;
+    }
+
+    /**
+     * @brief Earliest time (ms) at which update() has timing work to do.
+     * @param now Current time (ms).
+     * @return Absolute timestamp (now if already due), or UB::kNoDeadline when idle.
+     * @note Covers open debounce windows and pending double-click windows. Call it after
+     *       consuming events: a deferred Short waits for the previous event to be read.
+     */
+    [[nodiscard]] uint32_t nextDeadline(uint32_t now) const noexcept override
+    {
+        uint32_t wait = UB::kNoDeadline;
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            uint32_t m = (raw_[w] ^ state_[w]) | pending_[w];
+            while (m)
+            {
+                const size_t i = (w << 5) + UB::bits::lowestSet(m);
+                m &= m - 1u;
+
+                if (UB::bits::test(raw_, i) != UB::bits::test(state_, i))
+                    foldDeadline_(wait, now, last_change_[i] + Timing::debounce_ms);
+                // A pending Short can only fire once both raw and committed state are released.
+                if (UB::bits::test(pending_, i) && !UB::bits::test(state_, i) && !UB::bits::test(raw_, i))
+                    foldDeadline_(wait, now, pending_since_[i] + Timing::double_click_ms);
+            }
+        }
+        return deadlineAt_(now, wait);
+    }
+
+    /**
+     * @brief Clear all pending events and re-initialize debounced state.
+     */
+    void reset() noexcept override
+    {
+        const uint32_t t0 = time_now_();
+        clear_(t0);
+    }
+
+    // ---- Enum-friendly overloads (no cast needed in sketches) ---- //
+
+    /**
+     * @brief Enum-friendly overload of isPressed().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return true if the debounced state is pressed; false otherwise.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] bool isPressed(E buttonId) const noexcept
+    {
+        return isPressed(static_cast<uint8_t>(buttonId));
+    }
+
+    /**
+     * @brief Enum-friendly overload of getPressType().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return ButtonPressType event: Short, Long, Double, or None.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    ButtonPressType getPressType(E buttonId) noexcept
+    {
+        return getPressType(static_cast<uint8_t>(buttonId));
+    }
+
+    /**
+     * @brief Enum-friendly overload of peekPressType().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return Pending ButtonPressType event without consuming it.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] ButtonPressType peekPressType(E buttonId) const noexcept
+    {
+        return peekPressType(static_cast<uint8_t>(buttonId));
+    }
+
+    /**
+     * @brief Enum-friendly overload of getLastPressDuration().
+     * @tparam E Enum type (must satisfy std::is_enum<E>::value).
+     * @param buttonId Enumerated button identifier.
+     * @return Milliseconds of the most recent completed press, or 0.
+     */
+    template <typename E, UB::compat::enable_if_t<UB::compat::is_enum<E>::value, int> = 0>
+    [[nodiscard]] uint32_t getLastPressDuration(E buttonId) const noexcept
+    {
+        return getLastPressDuration(static_cast<uint8_t>(buttonId));
+    }
+
+private:
+    // ---- Storage ---- //
+
+    uint8_t pins_[N]{};                  ///< Pin or logical IDs.
+    uint32_t state_[kWords]{};           ///< Committed (debounced) state, packed.
+    uint32_t raw_[kWords]{};             ///< Most recent raw state (after polarity), packed.
+    uint32_t pending_[kWords]{};         ///< Pending single waiting for possible double, packed.
+    uint32_t last_change_[N]{};          ///< Timestamp (ms) when raw state last changed.
+    uint32_t press_start_[N]{};          ///< Timestamp (ms) when the committed press started.
+    uint32_t pending_since_[N]{};        ///< Timestamp (ms) of first short release.
+    uint32_t last_duration_[N]{};        ///< Last measured press duration (ms), set on release.
+    ButtonPressType event_[N]{};         ///< Pending event per button.
+    ReadPinFn read_pin_fn_{nullptr};     ///< Optional fast-path reader (per-pin).
+    ReadFn read_fn_{nullptr};            ///< Optional context-aware reader.
+    ReadBankFn read_bank_fn_{nullptr};   ///< Optional bulk reader.
+    void *read_ctx_{nullptr};            ///< Opaque context for read_fn_/read_bank_fn_.
+    TimeFn time_fn_{nullptr};            ///< Optional time source.
+
+    static constexpr uint32_t kInvert = Policy::active_low ? 0U : ~static_cast<uint32_t>(0U); ///< Raw XOR mask.
+
+    /**
+     * @brief Shared constructor body.
+     * @param buttonPins Reference to an array of length N with pin IDs.
+     * @param skipPinInit If true, GPIO mode is not configured.
+     */
+    void init_(const uint8_t (&buttonPins)[N], bool skipPinInit) noexcept
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            pins_[i] = buttonPins[i];
+#if UB_HAS_ARDUINO
+            if (!skipPinInit)
+                pinMode(pins_[i], INPUT_PULLUP);
+#endif
+        }
+        (void)skipPinInit;
+        clear_(time_now_());
+    }
+
+    /**
+     * @brief Clear all runtime state.
+     * @param t0 Timestamp to restart debounce windows from.
+     */
+    void clear_(uint32_t t0) noexcept
+    {
+        for (size_t w = 0; w < kWords; ++w)
+        {
+            state_[w] = 0U;
+            raw_[w] = 0U;
+            pending_[w] = 0U;
+        }
+        for (size_t i = 0; i < N; ++i)
+        {
+            last_change_[i] = t0;
+            press_start_[i] = 0U;
+            pending_since_[i] = 0U;
+            last_duration_[i] = 0U;
+            event_[i] = ButtonPressType::None;
+        }
+    }
+
+    /**
+     * @brief Sample all buttons into a packed raw bitmap (after polarity).
+     * @param raw Destination bitmap of kWords words.
+     */
+    inline void sample_(uint32_t *raw) noexcept
+    {
+        for (size_t w = 0; w < kWords; ++w)
+            raw[w] = 0U;
+
+        if (read_bank_fn_)
+        {
+            read_bank_fn_(read_ctx_, raw, kWords);
+        }
+        else
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                bool p;
+                if (read_pin_fn_)
+                    p = read_pin_fn_(pins_[i]);
+                else if (read_fn_)
+                    p = read_fn_(read_ctx_, pins_[i]);
+                else
+                    p = readNative_(pins_[i]);
+                if (p)
+                    UB::bits::assign(raw, i, true);
+            }
+        }
+
+        // Apply polarity word-wide and drop padding bits beyond N.
+        for (size_t w = 0; w < kWords; ++w)
+            raw[w] ^= kInvert;
+        if (N & 31u)
+            raw[kWords - 1] &= (static_cast<uint32_t>(1u) << (N & 31u)) - 1u;
+    }
+
+    /**
+     * @brief Debounce and classify one active button.
+     * @param i Button index.
+     * @param r Raw (post-polarity) level this scan.
+     * @param now Current time (ms).
+     */
+    inline void step_(size_t i, bool r, uint32_t now) noexcept
+    {
+        if (r != UB::bits::test(raw_, i))
+        {
+            UB::bits::assign(raw_, i, r);
+            last_change_[i] = now;
+        }
+
+        const bool committed = UB::bits::test(state_, i);
+        if (committed != r && (now - last_change_[i]) >= Timing::debounce_ms)
+        {
+            UB::bits::assign(state_, i, r);
+            if (r)
+            {
+                press_start_[i] = now;
+            }
+            else
+            {
+                const uint32_t duration = now - press_start_[i];
+                last_duration_[i] = duration;
+
+                if (duration >= Timing::long_press_ms)
+                {
+                    event_[i] = ButtonPressType::Long;
+                }
+                else if (duration >= Timing::short_press_ms)
+                {
+                    if (UB::bits::test(pending_, i) && (now - pending_since_[i]) <= Timing::double_click_ms)
+                    {
+                        event_[i] = ButtonPressType::Double;
+                        UB::bits::assign(pending_, i, false);
+                    }
+                    else
+                    {
+                        UB::bits::assign(pending_, i, true);
+                        pending_since_[i] = now;
+                    }
+                }
+                else
+                {
+                    event_[i] = ButtonPressType::None;
+                }
+            }
+        }
+
+        // Flush pending single-click only when both raw and debounced state are released.
+        if (UB::bits::test(pending_, i) && event_[i] == ButtonPressType::None &&
+            !UB::bits::test(state_, i) && !r && (now - pending_since_[i]) >= Timing::double_click_ms)
+        {
+            event_[i] = ButtonPressType::Short;
+            UB::bits::assign(pending_, i, false);
+        }
+    }
+
+    /**
+     * @brief Read a native Arduino GPIO button (LOW => true).
+     * @param pin MCU GPIO pin number.
+     * @return Reader-convention level; inactive outside Arduino builds.
+     */
+    static inline bool readNative_(uint8_t pin) noexcept
+    {
+#if UB_HAS_ARDUINO
+        return digitalRead(pin) == LOW;
+#else
+        (void)pin;
+        // Return the value that becomes "not pressed" after the polarity transform.
+        return !Policy::active_low;
+#endif
+    }
+
+    /**
+     * @brief Resolve the current time in ms (TimeFn, else Arduino millis(), else 0).
+     */
+    inline uint32_t time_now_() const noexcept
+    {
+        if (time_fn_)
+            return time_fn_();
+#if UB_HAS_ARDUINO
+        return millis();
+#else
+        return 0U;
+#endif
+    }
+};
@@ -13,6 +13,10 @@
 
 #include <ButtonHandler_Config.h>
 #include <ButtonHandler.h>
+#include <StaticButtonHandler.h>
+#include <MatrixReader.h>
+#include <AsyncReader.h>
+#include <ButtonGroup.h>
 
 // ---- Version macro ---- //
 
@@ -22,6 +26,14 @@
 
 using Button = ButtonHandler<NUM_BUTTONS>;
 
+/**
+ * @brief Config-driven alias for the compile-time specialised handler.
+ * @tparam Timing StaticTiming<debounce, short, long, double> (ms).
+ * @tparam Policy StaticPolicy<active_low>.
+ */
+template <typename Timing = StaticTiming<>, typename Policy = StaticPolicy<>>
+using StaticButton = StaticButtonHandler<NUM_BUTTONS, Timing, Policy>;
+
 // ---- Native GPIO readers (active-low with INPUT_PULLUP) ---- //
 
 /**
@@ -38,7 +50,7 @@ using Button = ButtonHandler<NUM_BUTTONS>;
  */
 template <size_t N>
 inline ButtonHandler<N> makeButtonsWithPins(const uint8_t (&pins)[N],
-                                            ButtonTimingConfig timing = {},
+                                            ButtonTimingConfig timing = UB::time::defaultTiming<UB_TIME_BASE>(),
                                             bool skipPinInit = false)
 {
     return ButtonHandler<N>(pins, timing, skipPinInit);
@@ -54,7 +66,7 @@ inline ButtonHandler<N> makeButtonsWithPins(const uint8_t (&pins)[N],
  * @param skipPinInit If true, GPIO mode is NOT configured in this factory.
  * @return A ready-to-use Button.
  */
-inline Button makeButtons(ButtonTimingConfig timing = {}, bool skipPinInit = false)
+inline Button makeButtons(ButtonTimingConfig timing = UB::time::defaultTiming<UB_TIME_BASE>(), bool skipPinInit = false)
 {
     return Button(BUTTON_PINS, timing, skipPinInit);
 }
@@ -74,7 +86,7 @@ inline Button makeButtons(ButtonTimingConfig timing = {}, bool skipPinInit = fal
  * @return A Button sized by NUM_BUTTONS.
  */
 inline Button makeButtonsWithReader(bool (*read)(uint8_t),
-                                    ButtonTimingConfig timing = {},
+                                    ButtonTimingConfig timing = UB::time::defaultTiming<UB_TIME_BASE>(),
                                     bool skipPinInit = true)
 {
     return Button(BUTTON_PINS, read, timing, skipPinInit);
@@ -96,7 +108,7 @@ inline Button makeButtonsWithReader(bool (*read)(uint8_t),
 template <size_t N>
 inline ButtonHandler<N> makeButtonsWithPinsAndReader(const uint8_t (&pins)[N],
                                                      bool (*read)(uint8_t),
-                                                     ButtonTimingConfig timing = {},
+                                                     ButtonTimingConfig timing = UB::time::defaultTiming<UB_TIME_BASE>(),
                                                      bool skipPinInit = true)
 {
     return ButtonHandler<N>(pins, read, timing, skipPinInit);
@@ -119,7 +131,7 @@ inline ButtonHandler<N> makeButtonsWithPinsAndReader(const uint8_t (&pins)[N],
  * @return A Button sized by NUM_BUTTONS.
  */
 inline Button makeButtonsWithReaderCtx(bool (*read)(void *, uint8_t), void *ctx,
-                                       ButtonTimingConfig timing = {},
+                                       ButtonTimingConfig timing = UB::time::defaultTiming<UB_TIME_BASE>(),
                                        bool skipPinInit = true)
 {
     return Button(BUTTON_PINS, read, ctx, timing, skipPinInit);
@@ -142,12 +154,83 @@ inline Button makeButtonsWithReaderCtx(bool (*read)(void *, uint8_t), void *ctx,
 template <size_t N>
 inline ButtonHandler<N> makeButtonsWithPinsAndReaderCtx(const uint8_t (&pins)[N],
                                                         bool (*read)(void *, uint8_t), void *ctx,
-                                                        ButtonTimingConfig timing = {},
+                                                        ButtonTimingConfig timing = UB::time::defaultTiming<UB_TIME_BASE>(),
                                                         bool skipPinInit = true)
 {
     return ButtonHandler<N>(pins, read, ctx, timing, skipPinInit);
 }
 
+// ---- External readers (bulk bank reader) ---- //
+
+/**
+ * @brief Config-driven factory with a bulk bank reader.
+ *
+ * Useful when one bus transaction returns many buttons at once (e.g., an
+ * MCP23017 GPIOAB read or a shift-register chain). The reader is called once
+ * per update() and sets bit i of the zeroed bitmap when logical button i is
+ * pressed (already polarity-corrected for your hardware).
+ *
+ * @param read Reader: void(void* ctx, uint32_t* words, size_t nwords) → pressed bitmap.
+ * @param ctx Opaque pointer passed back to read on each call.
+ * @param timing Global debounce/press-duration configuration.
+ * @param skipPinInit If true, pinMode is not called for BUTTON_PINS.
+ * @return A Button sized by NUM_BUTTONS.
+ */
+inline Button makeButtonsWithBankReader(void (*read)(void *, uint32_t *, size_t), void *ctx,
+                                        ButtonTimingConfig timing = UB::time::defaultTiming<UB_TIME_BASE>(),
+                                        bool skipPinInit = true)
+{
+    return Button(BUTTON_PINS, read, ctx, timing, skipPinInit);
+}
+
+/**
+ * @brief Explicit-pins factory with a bulk bank reader.
+ *
+ * Same as makeButtonsWithBankReader, but you provide the pins array explicitly
+ * instead of using the config mapping.
+ *
+ * @tparam N Number of buttons (deduced from pins).
+ * @param pins Reference to an array of length N with key IDs.
+ * @param read Reader: void(void* ctx, uint32_t* words, size_t nwords) → pressed bitmap.
+ * @param ctx Opaque pointer passed back to read on each call.
+ * @param timing Global debounce/press-duration configuration.
+ * @param skipPinInit If true, pinMode is not called for pins.
+ * @return A ButtonHandler<N>.
+ */
+template <size_t N>
+inline ButtonHandler<N> makeButtonsWithPinsAndBankReader(const uint8_t (&pins)[N],
+                                                         void (*read)(void *, uint32_t *, size_t), void *ctx,
+                                                         ButtonTimingConfig timing = UB::time::defaultTiming<UB_TIME_BASE>(),
+                                                         bool skipPinInit = true)
+{
+    return ButtonHandler<N>(pins, read, ctx, timing, skipPinInit);
+}
+
+// ---- Key matrix ---- //
+
+/**
+ * @brief Factory for a handler fed by a MatrixReader (one button per key).
+ *
+ * Key (row, col) becomes logical button row * Cols + col. The matrix is scanned
+ * once per update() through the bank-reader path; no BUTTON_LIST is needed.
+ *
+ * @tparam Rows Matrix rows (deduced).
+ * @tparam Cols Matrix columns (deduced).
+ * @param matrix Scanner; must outlive the returned handler.
+ * @param timing Global debounce/press-duration configuration.
+ * @return A ButtonHandler<Rows * Cols>.
+ */
+template <uint8_t Rows, uint8_t Cols>
+inline ButtonHandler<static_cast<size_t>(Rows) * Cols> makeButtonsWithMatrix(MatrixReader<Rows, Cols> &matrix,
+                                                                             ButtonTimingConfig timing = UB::time::defaultTiming<UB_TIME_BASE>())
+{
+    uint8_t keys[static_cast<size_t>(Rows) * Cols];
+    for (size_t k = 0; k < sizeof(keys); ++k)
+        keys[k] = static_cast<uint8_t>(k);
+    return ButtonHandler<static_cast<size_t>(Rows) * Cols>(keys, &MatrixReader<Rows, Cols>::readBank, &matrix,
+                                                           timing, /*skipPinInit=*/true);
+}
+
 // ---- Time-source overloads (useful for RTOS or non-Arduino adapter mode) ---- //
 
 /**
@@ -259,3 +342,43 @@ inline ButtonHandler<N> makeButtonsWithPinsAndReaderCtx(const uint8_t (&pins)[N]
 {
     return ButtonHandler<N>(pins, read, ctx, timing, skipPinInit, timeFn);
 }
+
+/**
+ * @brief Config-driven factory with bulk bank reader and optional time source.
+ *
+ * @param read Reader: void(void* ctx, uint32_t* words, size_t nwords) → pressed bitmap.
+ * @param ctx Opaque pointer passed back to read on each call.
+ * @param timing Global debounce/press-duration configuration.
+ * @param skipPinInit If true, pinMode is not called for BUTTON_PINS.
+ * @param timeFn Optional time source (ms). nullptr uses millis() on Arduino; non-Arduino users should supply one.
+ * @return A Button sized by NUM_BUTTONS.
+ */
+inline Button makeButtonsWithBankReader(void (*read)(void *, uint32_t *, size_t), void *ctx,
+                                        ButtonTimingConfig timing,
+                                        bool skipPinInit,
+                                        Button::TimeFn timeFn)
+{
+    return Button(BUTTON_PINS, read, ctx, timing, skipPinInit, timeFn);
+}
+
+/**
+ * @brief Explicit-pins factory with bulk bank reader and optional time source.
+ *
+ * @tparam N Number of buttons (deduced from pins).
+ * @param pins Reference to an array of length N with key IDs.
+ * @param read Reader: void(void* ctx, uint32_t* words, size_t nwords) → pressed bitmap.
+ * @param ctx Opaque pointer passed back to read on each call.
+ * @param timing Global debounce/press-duration configuration.
+ * @param skipPinInit If true, pinMode is not called for pins.
+ * @param timeFn Optional time source (ms). nullptr uses millis() on Arduino; non-Arduino users should supply one.
+ * @return A ButtonHandler<N>.
+ */
+template <size_t N>
+inline ButtonHandler<N> makeButtonsWithPinsAndBankReader(const uint8_t (&pins)[N],
+                                                         void (*read)(void *, uint32_t *, size_t), void *ctx,
+                                                         ButtonTimingConfig timing,
+                                                         bool skipPinInit,
+                                                         typename ButtonHandler<N>::TimeFn timeFn)
+{
+    return ButtonHandler<N>(pins, read, ctx, timing, skipPinInit, timeFn);
+}
@@ -3,7 +3,7 @@
  *
  * @brief Small, device-agnostic helpers for Universal_Button sketches and adapters:
  *        map configured BUTTON_PINS “keys” to logical indices, plus a generic
- *        variant for explicit pin arrays.
+ *        variant for explicit pin arrays, and port-word helpers for bank readers.
  *
  * @file Universal_Button_Utils.h
  * @author Little Man Builds (Darren Osborne)
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <ButtonCompatibility.h>
+#include <ButtonBits.h>
 
 #ifndef UB_UTIL_NO_CONFIG_MAP
 #include <ButtonHandler_Config.h>
@@ -21,9 +22,42 @@
 
 namespace UB::util
 {
+    namespace detail
+    {
+        /**
+         * @brief Constant-expression linear search (first match wins).
+         * @return Index of @p key in @p pins from @p i on, or 0xFF.
+         */
+        template <size_t N>
+        constexpr uint8_t findKey(const uint8_t (&pins)[N], uint8_t key, size_t i = 0)
+        {
+            return (i >= N) ? static_cast<uint8_t>(0xFF)
+                            : ((pins[i] == key) ? static_cast<uint8_t>(i) : findKey(pins, key, i + 1));
+        }
+
+#ifndef UB_UTIL_NO_CONFIG_MAP
+        template <typename Seq>
+        struct ConfigKeys;
+
+        /**
+         * @brief key -> index table for BUTTON_PINS, generated at compile time (flash on AVR).
+         */
+        template <size_t... K>
+        struct ConfigKeys<UB::compat::index_sequence<K...>>
+        {
+            static constexpr uint8_t table[sizeof...(K)] UB_PROGMEM = {findKey(BUTTON_PINS, static_cast<uint8_t>(K))...};
+        };
+
+        template <size_t... K>
+        constexpr uint8_t ConfigKeys<UB::compat::index_sequence<K...>>::table[sizeof...(K)] UB_PROGMEM;
+#endif
+    } // namespace detail
+
 #ifndef UB_UTIL_NO_CONFIG_MAP
     /**
      * @brief Map a BUTTON_PINS "key" (the configured pin value) to its logical index.
+     * @note O(1): one lookup in a 256-byte table generated from BUTTON_LIST at compile time
+     *       (kept in flash on AVR).
      * @note Define UB_UTIL_NO_CONFIG_MAP before including this header to omit this helper
      *       when only generic array-based mapping is needed.
      * @return 0..NUM_BUTTONS-1 on success, 0xFF if not found.
@@ -32,30 +66,88 @@ namespace UB::util
     {
         static_assert(NUM_BUTTONS <= 255, "indexFromKey() supports up to 255 mapped keys.");
 
-        for (size_t i = 0; i < NUM_BUTTONS; ++i)
-        {
-            if (BUTTON_PINS[i] == key)
-                return static_cast<uint8_t>(i);
-        }
-        return 0xFF;
+        return UB_PGM_BYTE(&detail::ConfigKeys<UB::compat::make_index_sequence<256>>::table[key]);
     }
 #endif
 
+    /**
+     * @brief key -> index lookup table for an explicit pins array (generated indexFromKeyIn()).
+     *
+     * Build one next to a custom reader that maps keys on every scan:
+     *
+     *     static const UB::util::KeyTable<8> kKeys(MY_PINS);
+     *     bool readMy(uint8_t key) { return bus.bit(kKeys[key]); }
+     *
+     * @tparam N Number of keys (1..255).
+     * @note 256 bytes of RAM; duplicate keys map to their first index, like indexFromKeyIn().
+     */
+    template <size_t N>
+    class KeyTable
+    {
+        static_assert(N > 0 && N <= 255, "KeyTable<N>: N must be in 1..255.");
+
+    public:
+        /**
+         * @brief Build the table from @p pins.
+         * @param pins Key of each logical index.
+         */
+        explicit KeyTable(const uint8_t (&pins)[N]) noexcept
+        {
+            for (size_t k = 0; k < 256; ++k)
+                index_[k] = 0xFF;
+            for (size_t i = N; i-- > 0;)
+                index_[pins[i]] = static_cast<uint8_t>(i);
+        }
+
+        /**
+         * @brief Logical index of @p key.
+         * @return 0..N-1, or 0xFF if @p key is not in the array.
+         */
+        [[nodiscard]] uint8_t indexOf(uint8_t key) const noexcept { return index_[key]; }
+
+        /**
+         * @brief Shorthand for indexOf().
+         */
+        uint8_t operator[](uint8_t key) const noexcept { return index_[key]; }
+
+    private:
+        uint8_t index_[256]; ///< key -> logical index (0xFF = unmapped).
+    };
+
     /**
      * @brief Generic variant: map a key within an explicit pins array.
      * @tparam N Array length deduced from @p pins.
      * @return 0..N-1 on success, 0xFF if not found.
+     * @note Linear in N; readers that map every key on every scan should use KeyTable<N>.
+     *       constexpr, so a constant key in a constant array folds at compile time.
      */
     template <size_t N>
-    inline uint8_t indexFromKeyIn(const uint8_t (&pins)[N], uint8_t key)
+    constexpr uint8_t indexFromKeyIn(const uint8_t (&pins)[N], uint8_t key)
     {
         static_assert(N <= 255, "indexFromKeyIn() supports arrays up to 255 entries.");
 
-        for (size_t i = 0; i < N; ++i)
+        return detail::findKey(pins, key);
+    }
+
+    /**
+     * @brief Scatter one port-expander word into a bank reader bitmap.
+     * @tparam M Number of buttons on this port (deduced from @p portBits).
+     * @param port Raw port word as read from the device (e.g., MCP23017 GPIOAB).
+     * @param portBits portBits[j] is the port bit (0..31) wired to logical button first + j.
+     * @param words Bank reader bitmap (as passed to a ReadBankFn).
+     * @param first Logical index of the first button on this port (for multi-device banks).
+     * @param pressedLow true => a LOW bit means pressed (pull-up wiring).
+     * @note Only sets bits; ButtonHandler zeroes the bitmap before each ReadBankFn call.
+     */
+    template <size_t M>
+    inline void gatherPortBits(uint32_t port, const uint8_t (&portBits)[M], uint32_t *words,
+                               size_t first = 0, bool pressedLow = true)
+    {
+        const uint32_t level = pressedLow ? ~port : port;
+        for (size_t j = 0; j < M; ++j)
         {
-            if (pins[i] == key)
-                return static_cast<uint8_t>(i);
+            if ((level >> (portBits[j] & 31u)) & 1u)
+                UB::bits::assign(words, first + j, true);
         }
-        return 0xFF;
     }
 } ///< namespace UB::util
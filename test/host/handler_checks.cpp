@@ -0,0 +1,530 @@
+/**
+ * @file handler_checks.cpp
+ *
+ * @brief Host regression checks for ButtonHandler<N> behaviour that a trace replay
+ *        does not reach (event FIFO, timing changes, time bases, idle scanning).
+ *
+ * Built by test/CMakeLists.txt with UB_EVENT_QUEUE_SIZE and UB_EDGE_QUEUE_SIZE enabled,
+ * once per state layout, again with the integrator engine, and again with the opt-in
+ * features (chords, stats, concurrent snapshot, adaptive debounce). Checks that depend on
+ * the timed engine or on a feature are compiled only where it applies. Exits non-zero on
+ * the first failed check.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ButtonHandler.h>
+#include <AsyncReader.h>
+#include <ButtonGroup.h>
+#include <MatrixReader.h>
+#include <StaticButtonHandler.h>
+
+#define UB_CHECK_TIMED (UB_DEBOUNCE_ENGINE == UB_DEBOUNCE_TIMED) ///< Engine-specific timing checks.
+
+#define CHECK(c)                                                          \
+    do                                                                    \
+    {                                                                     \
+        if (!(c))                                                         \
+        {                                                                 \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #c);           \
+            exit(1);                                                      \
+        }                                                                 \
+    } while (0)
+
+static bool levels[2]; ///< Pressed level per button.
+static bool readLevel(uint8_t k) { return levels[k]; }
+
+static uint32_t clockUs = 0; ///< Time source of the microsecond handlers.
+static uint32_t readClock() { return clockUs; }
+
+static const uint8_t kIds[2] = {0, 1};
+static const uint8_t kId0[1] = {0};
+
+/**
+ * A deferred Short must not overwrite an unread Long; its FIFO entry still goes out on time, once.
+ */
+static void shortWaitsForUnreadSlot()
+{
+    levels[0] = levels[1] = false;
+    ButtonHandler<1> h(kId0, readLevel, ButtonTimingConfig{20, 60, 700, 300});
+    uint32_t t = 0;
+    auto run = [&](uint32_t to) { for (; t < to; ++t) h.update(t); };
+    run(10);
+    levels[0] = true;
+    run(900); // Long
+    levels[0] = false;
+    run(1000);
+    levels[0] = true;
+    run(1100); // Short, deferred for the double-click window
+    levels[0] = false;
+    run(1600);
+
+    ButtonEvent ev[8];
+    CHECK(h.drainEvents(ev, 8) == 2);
+    CHECK(ev[0].type == ButtonPressType::Long);
+    CHECK(ev[1].type == ButtonPressType::Short && ev[1].duration == 100);
+#if UB_CHECK_TIMED
+    CHECK(ev[1].timestamp == 1420); // release committed at 1120, double-click window closes 300 ms later
+#endif
+    CHECK(h.getPressType(0) == ButtonPressType::Long);
+    run(1700);
+    CHECK(h.getPressType(0) == ButtonPressType::Short);
+    CHECK(h.drainEvents(ev, 8) == 0);
+}
+
+/**
+ * setGlobalTiming() keeps per-button overrides and retunes everything else.
+ */
+static void overridesSurviveTimingChange()
+{
+    levels[0] = levels[1] = false;
+    ButtonHandler<2> h(kIds, readLevel, ButtonTimingConfig{20, 60, 700, 0});
+    ButtonPerConfig c;
+    c.long_press_ms = 2000;
+    c.no_double = true;
+    h.setPerConfig(0, c);
+    h.setPerConfig(1, ButtonPerConfig{});
+    h.setGlobalTiming(ButtonTimingConfig{20, 60, 400, 250});
+
+    uint32_t t = 0;
+    auto run = [&](uint32_t to) { for (; t < to; ++t) h.update(t); };
+    run(10);
+    levels[0] = levels[1] = true;
+    run(1010);
+    levels[0] = levels[1] = false;
+    run(1100);
+    CHECK(h.getPressType(0) == ButtonPressType::Short); // still below its own 2000 ms Long
+    CHECK(h.getPressType(1) == ButtonPressType::Long);  // follows the new 400 ms Long
+    run(1200);
+    levels[0] = true;
+    run(1300);
+    levels[0] = false;
+    run(1330);
+    CHECK(h.getPressType(0) == ButtonPressType::Short); // no_double: no window even with a global one
+}
+
+/**
+ * Microsecond ticks: Compact holds longer than 65.5 ms, 0xFFFF is a real double-click window, and
+ * per-button overrides reach past 65.5 ms.
+ */
+static void microsecondTimeBase()
+{
+    levels[0] = levels[1] = false;
+    clockUs = 0xFFFE0000UL; // wraps during the run
+    ButtonHandler<1, UB::layout::Compact, UB::time::Micros> c(kId0, readLevel,
+                                                               UB::time::defaultTiming<UB::time::Micros>(), true,
+                                                               readClock);
+    ButtonPerConfig nd;
+    nd.no_double = true;
+    c.setPerConfig(0, nd);
+    auto scanC = [&](uint32_t n) { for (uint32_t k = 0; k < n; ++k) { clockUs += 250; c.update(); } };
+    scanC(10);
+    levels[0] = true;
+    scanC(4800); // 1.2 s
+    levels[0] = false;
+    scanC(400);
+    CHECK(c.getPressType(0) == ButtonPressType::Long);
+    CHECK(c.getLastPressDuration(0) == 1200000UL);
+
+    ButtonHandler<1, UB_STATE_LAYOUT, UB::time::Micros> w(kId0, readLevel,
+                                                          UB::time::defaultTiming<UB::time::Micros>(), true,
+                                                          readClock);
+    ButtonPerConfig d;
+    d.debounce_ms = 1000;
+    d.short_press_ms = 1000;
+    d.double_click_ms = 0xFFFF; // 65.535 ms
+    w.setPerConfig(0, d);
+    auto scanW = [&](uint32_t n) { for (uint32_t k = 0; k < n; ++k) { clockUs += 250; w.update(); } };
+    scanW(10);
+    levels[0] = true;
+    scanW(80);
+    levels[0] = false;
+    scanW(120);
+    levels[0] = true;
+    scanW(80);
+    levels[0] = false;
+    scanW(40);
+    CHECK(w.getPressType(0) == ButtonPressType::Double);
+
+    // Overrides are 32-bit ticks: a 2 s per-button Long threshold keeps a 1.2 s hold Short.
+    ButtonPerConfig lp;
+    lp.long_press_ms = 2000000UL;
+    lp.no_double = true;
+    w.setPerConfig(0, lp);
+    scanW(10);
+    levels[0] = true;
+    scanW(4800);
+    levels[0] = false;
+    scanW(400);
+    CHECK(w.getPressType(0) == ButtonPressType::Short);
+    CHECK(w.getLastPressDuration(0) == 1200000UL);
+}
+
+/**
+ * Idle scanning: an edge drained from the queue counts as activity even if the level ends unchanged.
+ */
+static void idleScanSeesQueuedEdges()
+{
+    levels[0] = levels[1] = false;
+    ButtonHandler<2> h(kIds, readLevel, ButtonTimingConfig{10, 50, 1000, 300});
+    h.setIdleScan(2000, 50);
+    h.setEdgeMode(true);
+    uint32_t t = 0;
+    for (; t < 3000; t += 50)
+        h.update(t);
+    CHECK(h.recommendedScanIntervalTicks(t) == 50);
+    h.onEdgeISR(0, true, t + 10);
+    h.onEdgeISR(0, false, t + 11);
+    h.update(t + 20);
+    h.update(t + 100);
+    CHECK(h.recommendedScanIntervalTicks(t + 100) == 1);
+}
+
+#if UB_CHECK_TIMED
+/**
+ * Edge queue: an edge stamped after the consuming update() read its clock still debounces.
+ * (The integrator debounces per scan and does not use edge timestamps.)
+ */
+static void futureEdgeStillDebounces()
+{
+    levels[0] = levels[1] = false;
+    ButtonHandler<1> h(kId0, readLevel, ButtonTimingConfig{20, 60, 700, 0});
+    h.setEdgeMode(true);
+    uint32_t t = 0;
+    for (; t < 100; ++t)
+        h.update(t);
+
+    h.onEdgeISR(0, true, t + 5); // bounce that landed after update() read t
+    h.update(t);
+    CHECK(!h.isPressed(0));
+    h.onEdgeISR(0, false, t + 6);
+    for (const uint32_t end = t + 200; t < end; ++t)
+        h.update(t);
+    CHECK(!h.isPressed(0));
+    ButtonEvent ev[4];
+    CHECK(h.drainEvents(ev, 4) == 0);
+
+    h.onEdgeISR(0, true, t + 3);
+    const uint32_t pressAt = t;
+    for (const uint32_t end = t + 19; t < end; ++t)
+        h.update(t);
+    CHECK(!h.isPressed(0));
+    for (const uint32_t end = pressAt + 120; t < end; ++t)
+        h.update(t);
+    CHECK(h.isPressed(0));
+    h.onEdgeISR(0, false, t);
+    for (const uint32_t end = t + 100; t < end; ++t)
+        h.update(t);
+    CHECK(h.drainEvents(ev, 4) == 1);
+    CHECK(ev[0].type == ButtonPressType::Short && ev[0].duration == 120);
+}
+#endif
+
+static uint8_t *asyncDst = nullptr; ///< Back buffer of the in-flight AsyncReader transfer.
+static bool startAsync(void *, uint8_t *dst, size_t) { asyncDst = dst; return true; }
+
+/**
+ * AsyncReader: keys beyond the snapshot read released, mapped keys follow completed transfers.
+ */
+static void asyncReaderKeys()
+{
+    AsyncReader<1> bus(startAsync, nullptr);
+    static const uint8_t keys[2] = {0, 9}; // key 9 is past the one-byte snapshot
+    ButtonHandler<2> h(keys, AsyncReader<1>::readKeyLow, &bus, ButtonTimingConfig{20, 60, 700, 0});
+    for (uint32_t t = 0; t < 100; ++t)
+    {
+        bus.poll();
+        if (asyncDst)
+        {
+            asyncDst[0] = (t >= 30) ? 0xFEu : 0xFFu; // key 0 pulled LOW from t = 30
+            asyncDst = nullptr;
+            bus.onTransferComplete();
+        }
+        h.update(t);
+    }
+    CHECK(h.isPressed(0));
+    CHECK(!h.isPressed(1));
+}
+
+/**
+ * Edge queue: an overflow is counted, and the next update() re-seeds levels from the reader.
+ */
+static void edgeOverflowReseeds()
+{
+    levels[0] = levels[1] = false;
+    ButtonHandler<2> h(kIds, readLevel, ButtonTimingConfig{10, 50, 1000, 0});
+    h.setEdgeMode(true);
+    uint32_t t = 0;
+    for (; t < 50; ++t)
+        h.update(t);
+
+    bool dropped = false;
+    for (uint8_t k = 0; k < UB_EDGE_QUEUE_SIZE + 2; ++k)
+        dropped |= !h.onEdgeISR(1, (k & 1u) == 0u, t);
+    CHECK(dropped && h.edgeOverflowCount() != 0);
+    levels[1] = true; // the level the lost edges ended on
+    for (const uint32_t end = t + 100; t < end; ++t)
+        h.update(t);
+    CHECK(h.isPressed(1) && !h.isPressed(0));
+    CHECK(h.recommendedScanIntervalTicks(t) == 1);
+}
+
+static uint32_t matrixKeys[3]; ///< Closed columns per row.
+static uint8_t matrixRow = 0xFF; ///< Active row, 0xFF = none.
+static void selectRow(void *, uint8_t row, bool active) { matrixRow = active ? row : 0xFF; }
+static uint32_t readCols(void *) { return (matrixRow < 3) ? matrixKeys[matrixRow] : 0U; }
+
+/**
+ * MatrixReader: key (row, col) is button row * Cols + col; ghost detection holds ambiguous rows.
+ */
+static void matrixReaderKeys()
+{
+    MatrixReader<3, 4> m(selectRow, readCols, nullptr);
+    static const uint8_t keys[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    ButtonHandler<12> h(keys, MatrixReader<3, 4>::readBank, &m, ButtonTimingConfig{10, 50, 1000, 0});
+    uint32_t t = 0;
+    auto run = [&](uint32_t n) { for (const uint32_t end = t + n; t < end; ++t) h.update(t); };
+    run(10);
+    matrixKeys[2] = 1u << 1; // (2, 1)
+    run(50);
+    CHECK(h.isPressed(9));
+    for (uint8_t i = 0; i < 12; ++i)
+        CHECK(h.isPressed(i) == (i == 9));
+
+    matrixKeys[2] = 0;
+    run(50);
+    m.setGhostDetection(true);
+    matrixKeys[0] = 0x3u; // (0, 0) (0, 1)
+    run(50);
+    CHECK(h.isPressed(0) && h.isPressed(1) && !m.ghosted());
+    matrixKeys[1] = 0x3u; // rows 0 and 1 share two columns: ambiguous, both keep their last value
+    run(50);
+    CHECK(m.ghosted() && !h.isPressed(4) && !h.isPressed(5) && h.isPressed(0));
+    matrixKeys[1] = 0;
+    run(50);
+    CHECK(!m.ghosted() && h.isPressed(0) && h.isPressed(1));
+}
+
+static uint32_t groupReads[2]; ///< Bank reads per group member.
+static void readFast(void *, uint32_t *w, size_t) { ++groupReads[0]; w[0] = levels[0] ? 1u : 0u; }
+static void readSlow(void *, uint32_t *w, size_t) { ++groupReads[1]; w[0] = levels[1] ? 1u : 0u; }
+
+/**
+ * ButtonGroup: members are scanned at their own period and a full group rejects new members.
+ */
+static void groupScansAtPeriods()
+{
+    levels[0] = levels[1] = false;
+    groupReads[0] = groupReads[1] = 0;
+    ButtonHandler<1> fast(kId0, readFast, nullptr, ButtonTimingConfig{5, 20, 300, 0});
+    ButtonHandler<1> slow(kId0, readSlow, nullptr, ButtonTimingConfig{30, 20, 300, 0});
+    ButtonGroup<2> g;
+    CHECK(g.add(fast) == 0 && g.add(slow, 10) == 1 && g.add(fast) == 0xFF);
+    groupReads[0] = groupReads[1] = 0; // construction seeds levels
+    uint32_t t = 1000;
+    for (; t < 2000; ++t)
+        g.update(t);
+    CHECK(groupReads[0] == 1000 && groupReads[1] == 100);
+#if UB_CHECK_TIMED
+    CHECK(g.nextDeadline(t) == UB::kNoDeadline);
+    levels[1] = true;
+    g.update(2000); // slow sees the press at 2000: debounce due 2030, a scheduled scan
+    CHECK(g.nextDeadline(2001) == 2030);
+#endif
+    levels[0] = levels[1] = true;
+    for (t = 2001; t < 2200; ++t)
+        g.update(t);
+    CHECK(fast.isPressed(0) && slow.isPressed(0));
+}
+
+#if UB_CHECK_TIMED
+/**
+ * StaticButtonHandler: same results as a ButtonHandler with the same timing on a bouncy stream.
+ */
+static void staticMatchesDynamic()
+{
+    static const uint8_t pins[4] = {0, 1, 2, 3};
+    static bool sl[4];
+    struct R
+    {
+        static bool read(void *, uint8_t k) { return sl[k]; }
+    };
+    ButtonHandler<4> a(pins, R::read, nullptr, ButtonTimingConfig{20, 60, 700, 300});
+    StaticButtonHandler<4, StaticTiming<20, 60, 700, 300>> b(pins, R::read, nullptr);
+
+    uint32_t seed = 777;
+    auto rnd = [&]() { seed = seed * 1103515245u + 12345u; return (seed >> 8) & 0xFFFFFFu; };
+    uint32_t next[4] = {};
+    uint8_t bounce[4] = {};
+    uint32_t events = 0;
+    for (uint32_t t = 1; t < 60000; ++t)
+    {
+        for (uint8_t i = 0; i < 4; ++i)
+        {
+            if (t < next[i])
+                continue;
+            sl[i] = !sl[i];
+            if (bounce[i])
+                --bounce[i], next[i] = t + 1 + rnd() % 4;
+            else
+                bounce[i] = static_cast<uint8_t>((rnd() % 3) * 2), next[i] = t + 20 + rnd() % 900;
+        }
+        a.update(t);
+        b.update(t);
+        for (uint8_t i = 0; i < 4; ++i)
+        {
+            const ButtonPressType x = a.getPressType(i);
+            CHECK(x == b.getPressType(i) && a.isPressed(i) == b.isPressed(i));
+            CHECK(a.getLastPressDuration(i) == b.getLastPressDuration(i));
+            events += (x != ButtonPressType::None);
+        }
+    }
+    CHECK(events > 100);
+}
+#endif
+
+#if UB_CHORDS > 0
+/**
+ * Chords: a held chord fires once after its hold time and takes over its members' press.
+ */
+static void chordFiresOnce()
+{
+    levels[0] = levels[1] = false;
+    ButtonHandler<2> h(kIds, readLevel, ButtonTimingConfig{10, 50, 1000, 0});
+    const uint8_t c = h.addChordMask(0x3u, 200);
+    CHECK(c == 0);
+    uint32_t t = 0;
+    auto run = [&](uint32_t n) { for (const uint32_t end = t + n; t < end; ++t) h.update(t); };
+    run(10);
+    levels[0] = levels[1] = true;
+    run(150);
+    CHECK(h.isChordHeld(c) && !h.chordFired(c));
+    run(100);
+    CHECK(h.chordFired(c) && !h.chordFired(c));
+    levels[0] = levels[1] = false;
+    run(100);
+    CHECK(h.getPressType(0) == ButtonPressType::None && h.getPressType(1) == ButtonPressType::None);
+    ButtonEvent ev[4];
+    CHECK(h.drainEvents(ev, 4) == 1 && ev[0].type == ButtonPressType::Chord && ev[0].duration == 200);
+}
+#endif
+
+#if UB_STATS
+static uint32_t statsTick = 0; ///< Stats clock.
+static uint32_t readStatsTick() { return statsTick; }
+
+/**
+ * Stats: bounces inside an open window and completed presses are counted.
+ */
+static void statsCountBounces()
+{
+    levels[0] = levels[1] = false;
+    ButtonHandler<2> h(kIds, readLevel, ButtonTimingConfig{20, 50, 1000, 0});
+    h.setStatsClock(readStatsTick);
+    uint32_t t = 0;
+    auto run = [&](uint32_t n) { for (const uint32_t end = t + n; t < end; ++t) { statsTick += 3; h.update(t); } };
+    run(10);
+    for (uint8_t k = 0; k < 4; ++k)
+    {
+        levels[0] = (k & 1u) == 0u; // 1, 0, 1, 0 then held
+        run(2);
+    }
+    levels[0] = true;
+    run(100);
+    levels[0] = false;
+    run(40);
+    CHECK(h.stats().bounces[0] == 2 && h.stats().bounces[1] == 0);
+    CHECK(h.stats().press_hist[2] == 1); // about 100 ms: [64, 128)
+    CHECK(h.stats().update_ticks.count == t);
+    h.resetStats();
+    CHECK(h.stats().bounces[0] == 0 && h.stats().update_ticks.count == 0);
+}
+#endif
+
+#if UB_CONCURRENT
+/**
+ * Concurrent snapshot: readShared() publishes pressed bits and counts publications.
+ */
+static void sharedSnapshotFollowsUpdate()
+{
+    levels[0] = levels[1] = false;
+    ButtonHandler<2> h(kIds, readLevel, ButtonTimingConfig{10, 50, 1000, 0});
+    uint32_t t = 0;
+    for (; t < 10; ++t)
+        h.update(t);
+    uint32_t pressed[1], latched[1];
+    const uint32_t before = h.readShared(pressed, latched, 1);
+    CHECK(pressed[0] == 0U && !h.isPressedShared(1));
+    levels[1] = true;
+    for (const uint32_t end = t + 50; t < end; ++t)
+        h.update(t);
+    CHECK(h.readShared(pressed, latched, 1) > before);
+    CHECK(pressed[0] == 0x2U && h.isPressedShared(1) && !h.isPressedShared(0));
+}
+#endif
+
+#if UB_ADAPTIVE_DEBOUNCE
+/**
+ * Adaptive debounce: a clean switch learns a short window, a bouncy one a longer one.
+ */
+static void adaptiveDebounceLearns()
+{
+    levels[0] = levels[1] = false;
+    ButtonHandler<2> h(kIds, readLevel, ButtonTimingConfig{30, 50, 1000, 0});
+    CHECK(h.learnedDebounceTicks(0) == 30);
+    h.setAdaptiveDebounce(3, 40);
+    CHECK(h.learnedDebounceTicks(0) == 30);
+    uint32_t t = 0;
+    auto run = [&](uint32_t n) { for (const uint32_t end = t + n; t < end; ++t) h.update(t); };
+    run(10);
+    for (uint8_t p = 0; p < 40; ++p)
+    {
+        levels[0] = true;
+        for (uint8_t k = 0; k < 6; ++k) // button 1 bounces for 10 ms on each press
+        {
+            levels[1] = (k & 1u) == 0u;
+            run(2);
+        }
+        levels[1] = true;
+        run(150);
+        levels[0] = levels[1] = false;
+        run(150);
+    }
+    CHECK(h.learnedDebounceTicks(0) <= 6);
+    CHECK(h.learnedDebounceTicks(1) >= 12 && h.learnedDebounceTicks(1) <= 30);
+    h.setLearnedDebounceTicks(0, 100);
+    CHECK(h.learnedDebounceTicks(0) == 40);
+}
+#endif
+
+int main()
+{
+    shortWaitsForUnreadSlot();
+    overridesSurviveTimingChange();
+    microsecondTimeBase();
+    idleScanSeesQueuedEdges();
+#if UB_CHECK_TIMED
+    futureEdgeStillDebounces();
+#endif
+    asyncReaderKeys();
+    edgeOverflowReseeds();
+    matrixReaderKeys();
+    groupScansAtPeriods();
+#if UB_CHECK_TIMED
+    staticMatchesDynamic();
+#endif
+#if UB_CHORDS > 0
+    chordFiresOnce();
+#endif
+#if UB_STATS
+    statsCountBounces();
+#endif
+#if UB_CONCURRENT
+    sharedSnapshotFollowsUpdate();
+#endif
+#if UB_ADAPTIVE_DEBOUNCE
+    adaptiveDebounceLearns();
+#endif
+    printf("handler checks OK\n");
+    return 0;
+}